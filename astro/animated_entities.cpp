@@ -13,6 +13,19 @@ struct AnimationParams {
   bool immediate = false;
 };
 
+struct AnimatedPerson {
+  SkinnedPerson* person = nullptr;
+  GameEntity* entity = nullptr;
+};
+
+// Animated people and their rigs are gathered first, so all rigs can be
+// evaluated in one parallel batch before any meshes are synced to them.
+// These are kept around between frames to avoid reallocating them.
+static std::vector<AnimatedPerson> animated_lesser_guards;
+static std::vector<AnimatedPerson> animated_low_guards;
+static std::vector<AnimatedPerson> animated_npcs;
+static std::vector<AnimationJob> animation_jobs;
+
 bool IsEnemyHit(Tachyon* tachyon, GameEntity& entity) {
   auto& enemy = entity.enemy_state;
 
@@ -22,13 +35,15 @@ bool IsEnemyHit(Tachyon* tachyon, GameEntity& entity) {
   );
 }
 
-static void UpdateAnimation(tAnimationRig& rig, const float speed, const float dt) {
+static void QueueAnimation(tAnimationRig& rig, const float speed, const float dt) {
   // @todo allow upper body animation speed to be decoupled from main animation speed
   rig.upper_body_animation_time += speed * dt;
 
-  Animation::AccumulateTime(rig, 3.f, dt);
-  Animation::UpdatePose(rig, BLEND_LINEAR);
-  Animation::UpdateBoneMatrices(rig);
+  animation_jobs.push_back({
+    .rig = &rig,
+    .blend_rate = 3.f,
+    .blend_type = BLEND_LINEAR
+  });
 }
 
 static void SyncSkinnedMesh(tSkinnedMesh& mesh, GameEntity& entity, tAnimationRig& animation) {
@@ -161,7 +176,7 @@ static void HandleAnimatedPerson(State& state, SkinnedPerson& person, AnimationP
   person.rig.current_animation_speed = params.speed;
   person.rig.next_animation_speed = params.speed;
 
-  UpdateAnimation(person.rig, params.speed, state.dt);
+  QueueAnimation(person.rig, params.speed, state.dt);
 }
 
 /**
@@ -223,10 +238,7 @@ static AnimationParams GetLesserGuardAnimationParams(Tachyon* tachyon, State& st
   }
 }
 
-static void HandleAnimatedLesserGuards(Tachyon* tachyon, State& state, int32& usage_counter) {
-  auto& meshes = state.meshes;
-  auto& animations = state.animations;
-
+static void QueueAnimatedLesserGuards(Tachyon* tachyon, State& state, int32& usage_counter) {
   if (state.enemies_disabled) {
     return;
   }
@@ -234,6 +246,7 @@ static void HandleAnimatedLesserGuards(Tachyon* tachyon, State& state, int32& us
   for_entities(state.lesser_guards) {
     auto& entity = state.lesser_guards[i];
 
+    if (usage_counter >= MAX_ANIMATED_PEOPLE) break;
     if (abs(state.player_position.x - entity.visible_position.x) > 15000.f) continue;
     if (abs(state.player_position.z - entity.visible_position.z) > 15000.f) continue;
     if (!IsDuringActiveTime(entity, state)) continue;
@@ -243,6 +256,17 @@ static void HandleAnimatedLesserGuards(Tachyon* tachyon, State& state, int32& us
 
     HandleAnimatedPerson(state, person, animation_params);
 
+    animated_lesser_guards.push_back({ &person, &entity });
+  }
+}
+
+static void SyncAnimatedLesserGuards(Tachyon* tachyon, State& state) {
+  auto& meshes = state.meshes;
+
+  for (auto& [ person_pointer, entity_pointer ] : animated_lesser_guards) {
+    auto& person = *person_pointer;
+    auto& entity = *entity_pointer;
+
     tVec3f body_position = entity.visible_position;
     Quaternion body_rotation = entity.visible_rotation;
 
@@ -391,10 +415,7 @@ static AnimationParams GetLowGuardAnimationParams(Tachyon* tachyon, State& state
   }
 }
 
-static void HandleAnimatedLowGuards(Tachyon* tachyon, State& state, int32& usage_counter) {
-  auto& meshes = state.meshes;
-  auto& animations = state.animations;
-
+static void QueueAnimatedLowGuards(Tachyon* tachyon, State& state, int32& usage_counter) {
   if (state.enemies_disabled) {
     return;
   }
@@ -402,6 +423,7 @@ static void HandleAnimatedLowGuards(Tachyon* tachyon, State& state, int32& usage
   for_entities(state.low_guards) {
     auto& entity = state.low_guards[i];
 
+    if (usage_counter >= MAX_ANIMATED_PEOPLE) break;
     if (abs(state.player_position.x - entity.visible_position.x) > 15000.f) continue;
     if (abs(state.player_position.z - entity.visible_position.z) > 25000.f) continue;
     if (!IsDuringActiveTime(entity, state)) continue;
@@ -411,6 +433,17 @@ static void HandleAnimatedLowGuards(Tachyon* tachyon, State& state, int32& usage
 
     HandleAnimatedPerson(state, person, animation_params);
 
+    animated_low_guards.push_back({ &person, &entity });
+  }
+}
+
+static void SyncAnimatedLowGuards(Tachyon* tachyon, State& state) {
+  auto& meshes = state.meshes;
+
+  for (auto& [ person_pointer, entity_pointer ] : animated_low_guards) {
+    auto& person = *person_pointer;
+    auto& entity = *entity_pointer;
+
     tVec3f body_position = entity.visible_position;
     Quaternion body_rotation = entity.visible_rotation;
 
@@ -482,8 +515,7 @@ static void HandleAnimatedLowGuards(Tachyon* tachyon, State& state, int32& usage
  * NPCs
  * ----
  */
-static void HandleAnimatedNPCs(Tachyon* tachyon, State& state, int32& usage_counter) {
-  auto& meshes = state.meshes;
+static void QueueAnimatedNPCs(Tachyon* tachyon, State& state, int32& usage_counter) {
   auto& animations = state.animations;
 
   if (state.enemies_disabled) {
@@ -493,12 +525,12 @@ static void HandleAnimatedNPCs(Tachyon* tachyon, State& state, int32& usage_coun
   for_entities(state.npcs) {
     auto& entity = state.npcs[i];
 
+    if (usage_counter >= MAX_ANIMATED_PEOPLE) break;
     if (abs(state.player_position.x - entity.visible_position.x) > 15000.f) continue;
     if (abs(state.player_position.z - entity.visible_position.z) > 15000.f) continue;
     if (!IsDuringActiveTime(entity, state)) continue;
 
     auto& person = state.skinned_people[usage_counter++];
-    auto& body = skinned_mesh(person.body_mesh_index);
 
     if (person.rig.current_animation == nullptr) {
       person.rig.current_animation = &animations.person_idle;
@@ -507,7 +539,7 @@ static void HandleAnimatedNPCs(Tachyon* tachyon, State& state, int32& usage_coun
     float animation_speed;
 
     // @todo improve determinant for current talking npc
-    if (state.current_dialogue_set == entity.unique_name) {
+    if (state.current_dialogue_set_symbol == entity.unique_name_symbol) {
       Animation::SetNextAnimation(person.rig, &animations.person_talking);
 
       animation_speed = 1.75f;
@@ -517,8 +549,17 @@ static void HandleAnimatedNPCs(Tachyon* tachyon, State& state, int32& usage_coun
       animation_speed = 0.75f;
     }
 
-    UpdateAnimation(person.rig, animation_speed, state.dt);
-    SyncSkinnedMesh(body, entity, person.rig);
+    QueueAnimation(person.rig, animation_speed, state.dt);
+
+    animated_npcs.push_back({ &person, &entity });
+  }
+}
+
+static void SyncAnimatedNPCs(Tachyon* tachyon, State& state) {
+  for (auto& [ person, entity ] : animated_npcs) {
+    auto& body = skinned_mesh(person->body_mesh_index);
+
+    SyncSkinnedMesh(body, *entity, person->rig);
 
     commit(body);
   }
@@ -554,7 +595,20 @@ void AnimatedEntities::UpdateAnimatedEntities(Tachyon* tachyon, State& state) {
   // Use animated meshes on-demand based on proximity to entities
   int32 usage_counter = 0;
 
-  HandleAnimatedLesserGuards(tachyon, state, usage_counter);
-  HandleAnimatedLowGuards(tachyon, state, usage_counter);
-  HandleAnimatedNPCs(tachyon, state, usage_counter);
+  animated_lesser_guards.clear();
+  animated_low_guards.clear();
+  animated_npcs.clear();
+  animation_jobs.clear();
+
+  QueueAnimatedLesserGuards(tachyon, state, usage_counter);
+  QueueAnimatedLowGuards(tachyon, state, usage_counter);
+  QueueAnimatedNPCs(tachyon, state, usage_counter);
+
+  // Evaluate every queued rig in parallel, joining
+  // before any meshes are synced to the new poses
+  Animation::UpdateRigs(animation_jobs, state.dt);
+
+  SyncAnimatedLesserGuards(tachyon, state);
+  SyncAnimatedLowGuards(tachyon, state);
+  SyncAnimatedNPCs(tachyon, state);
 }
\ No newline at end of file
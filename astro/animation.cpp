@@ -1,4 +1,5 @@
 #include "astro/animation.h"
+#include "astro/animation_cache.h"
 
 using namespace astro;
 
@@ -11,32 +12,25 @@ static float SmoothStep(const float e1, const float e2, float x) {
   return x * x * (3.f - 2.f * x);
 }
 
-static void ReserveAnimationPoseData(tSkeletonAnimation& skeleton_animation) {
-  if (skeleton_animation.evaluated_pose.bones.size() == 0) {
-    for (auto& bone : skeleton_animation.frames[0].bones) {
-      skeleton_animation.evaluated_pose.bones.push_back(bone);
-    }
-  }
-}
-
 static float GetMaxSeekTime(tSkeletonAnimation& animation) {
-  return (float) animation.frames.size();
+  return (float) animation.total_frames;
 }
 
 static float Curve(const float t, const float k) {
   return t + k * (3.f * t * t - 2.f * t * t * t - t);
 }
 
-static void EvaluateAnimation(tSkeletonAnimation& animation, const float seek_time) {
-  int total_frames = (int) animation.frames.size();
+static void EvaluateAnimation(tSkeletonAnimation& animation, const float seek_time, tSkeleton& pose) {
+  int total_frames = (int) animation.total_frames;
   float max_time = GetMaxSeekTime(animation);
   float blend_alpha = fmodf(seek_time, 1.f);
   float t = seek_time;
 
-  // @temporary @todo Do this when loading the animations for the first time
-  ReserveAnimationPoseData(animation);
+  if (pose.bones.size() != animation.reference_pose.bones.size()) {
+    pose.bones = animation.reference_pose.bones;
+  }
 
-  if (total_frames== 2) {
+  if (total_frames == 2) {
     // Special treatment for 2-frame animations: alternate between
     // both frames using an ease-in-out transition
     blend_alpha = Tachyon_EaseInOutf(blend_alpha);
@@ -68,8 +62,8 @@ static void EvaluateAnimation(tSkeletonAnimation& animation, const float seek_ti
   int32 next_frame_index;
 
   if (animation.looping) {
-    current_frame_index = int(t) % animation.frames.size();
-    next_frame_index = (current_frame_index + 1) % animation.frames.size();
+    current_frame_index = int(t) % total_frames;
+    next_frame_index = (current_frame_index + 1) % total_frames;
   } else {
     // Frame cycling for non-looping animations, which we want to end
     // on the final frame exactly at t = max_time
@@ -85,28 +79,20 @@ static void EvaluateAnimation(tSkeletonAnimation& animation, const float seek_ti
     if (next_frame_index == total_frames) next_frame_index -= 1;
   }
 
-  auto& current_frame = animation.frames[current_frame_index];
-  auto& next_frame = animation.frames[next_frame_index];
-
-  for (size_t i = 0; i < current_frame.bones.size(); i++) {
-    auto& current_bone = current_frame.bones[i];
-    auto& next_bone = next_frame.bones[i];
-    Quaternion blended_rotation = Quaternion::nlerp(current_bone.rotation, next_bone.rotation, blend_alpha);
+  // Decode the blended keyframe rotations straight into the evaluated pose
+  AnimationCache::SampleRotations(animation, current_frame_index, next_frame_index, blend_alpha, pose);
 
-    animation.evaluated_pose.bones[i].rotation = blended_rotation;
-
-    // @todo blend translations (+ scale??)
-  }
+  // @todo blend translations (+ scale??)
 }
 
 // @todo refactor with EvaluateAnimation()
 static tVec3f GetSkeletonRootMotion(tSkeletonAnimation& animation, const float seek_time) {
-  int total_frames = (int) animation.frames.size();
+  int total_frames = (int) animation.total_frames;
   float max_time = GetMaxSeekTime(animation);
   float blend_alpha = fmodf(seek_time, 1.f);
   float t = seek_time;
 
-  if (animation.frames.size() == 2) {
+  if (total_frames == 2) {
     // Special treatment for 2-frame animations: alternate between
     // both frames using an ease-in-out transition
     blend_alpha = Tachyon_EaseInOutf(blend_alpha);
@@ -132,8 +118,8 @@ static tVec3f GetSkeletonRootMotion(tSkeletonAnimation& animation, const float s
   int32 next_frame_index;
 
   if (animation.looping) {
-    current_frame_index = int(t) % animation.frames.size();
-    next_frame_index = (current_frame_index + 1) % animation.frames.size();
+    current_frame_index = int(t) % total_frames;
+    next_frame_index = (current_frame_index + 1) % total_frames;
   } else {
     // Frame cycling for non-looping animations, which we want to end
     // on the final frame exactly at t = max_time
@@ -149,16 +135,11 @@ static tVec3f GetSkeletonRootMotion(tSkeletonAnimation& animation, const float s
     if (next_frame_index == total_frames) next_frame_index -= 1;
   }
 
-  auto& current_frame = animation.frames[current_frame_index];
-  auto& next_frame = animation.frames[next_frame_index];
-
-  for (size_t i = 0; i < current_frame.bones.size(); i++) {
-    auto& current_bone = current_frame.bones[i];
-    auto& next_bone = next_frame.bones[i];
+  auto& name_to_index_map = animation.reference_pose.name_to_index_map;
+  auto root = name_to_index_map.find("Root");
 
-    if (current_bone.name == "Root") {
-      return tVec3f::lerp(current_bone.translation, next_bone.translation, blend_alpha);
-    }
+  if (root != name_to_index_map.end()) {
+    return AnimationCache::SampleTranslation(animation, root->second, current_frame_index, next_frame_index, blend_alpha);
   }
 
   return tVec3f(0.f);
@@ -233,11 +214,11 @@ void Animation::UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_ty
 
   // Evaluate the current and next animations simultaneously so they can be blended
   // @optimize this only has to be done when transitioning between animations
-  EvaluateAnimation(current_animation, rig.current_animation_time);
-  EvaluateAnimation(next_animation, rig.next_animation_time);
+  EvaluateAnimation(current_animation, rig.current_animation_time, rig.current_pose);
+  EvaluateAnimation(next_animation, rig.next_animation_time, rig.next_pose);
 
   if (rig.upper_body_animation != nullptr) {
-    EvaluateAnimation(*rig.upper_body_animation, rig.upper_body_animation_time);
+    EvaluateAnimation(*rig.upper_body_animation, rig.upper_body_animation_time, rig.upper_body_pose);
   }
 
   // Update the active pose based on the blended result of the current/next animations
@@ -253,14 +234,14 @@ void Animation::UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_ty
 
     // Compute the active pose rotation by blending between the current/next animations
     // @optimize if the current and next animations are identical, this is unnecessary
-    for (size_t i = 0; i < current_animation.evaluated_pose.bones.size(); i++) {
-      auto& current_bone = current_animation.evaluated_pose.bones[i];
-      auto& next_bone = next_animation.evaluated_pose.bones[i];
+    for (size_t i = 0; i < rig.current_pose.bones.size(); i++) {
+      auto& current_bone = rig.current_pose.bones[i];
+      auto& next_bone = rig.next_pose.bones[i];
       auto& active_bone = active_pose.bones[i];
       Quaternion blended_rotation = Quaternion::nlerp(current_bone.rotation, next_bone.rotation, blend_alpha);
 
       // Reset active pose bone translation back to bone space
-      active_bone.translation = current_bone.translation;
+      active_bone.translation = current_animation.reference_pose.bones[i].translation;
 
       // Set blended rotation
       active_bone.rotation = blended_rotation;
@@ -282,7 +263,7 @@ void Animation::UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_ty
     if (rig.upper_body_animation != nullptr) {
       auto& animation = *rig.upper_body_animation;
       float seek_time = rig.upper_body_animation_time;
-      float progress = seek_time / float(animation.frames.size());
+      float progress = seek_time / float(animation.total_frames);
       if (progress > 1.f) progress = 1.f;
       // @todo make blend alpha configurable. Right now this assumes
       // we play the upper body once, ramping it up and then down again
@@ -292,7 +273,6 @@ void Animation::UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_ty
 
       for (size_t i = 0; i < active_pose.bones.size(); i++) {
         auto& active_bone = active_pose.bones[i];
-        auto& animation = *rig.upper_body_animation;
         auto& bone_name = active_bone.name;
 
         // Skip lower-body bones
@@ -301,7 +281,7 @@ void Animation::UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_ty
         if (bone_name.starts_with("Shin")) continue;
         if (bone_name.starts_with("Foot")) continue;
 
-        auto& upper_bone = animation.evaluated_pose.bones[active_bone.index];
+        auto& upper_bone = rig.upper_body_pose.bones[active_bone.index];
 
         active_bone.rotation = Quaternion::nlerp(active_bone.rotation, upper_bone.rotation, blend_alpha);
       }
@@ -313,9 +293,12 @@ void Animation::UpdateBoneMatrices(tAnimationRig& rig) {
   auto& rest_pose = rig.rest_pose;
   auto& active_pose = rig.active_pose;
 
-  active_pose.bone_matrices.clear();
+  // Write into the rig's own bone matrix buffer in place,
+  // so rigs can safely be updated on separate threads
+  active_pose.bone_matrices.resize(active_pose.bones.size());
 
-  for (auto& bone : active_pose.bones) {
+  for (size_t i = 0; i < active_pose.bones.size(); i++) {
+    auto& bone = active_pose.bones[i];
     int32 next_parent_index = bone.parent_bone_index;
 
     // @todo refactor to use TransformBonesIntoMeshSpace()
@@ -332,10 +315,29 @@ void Animation::UpdateBoneMatrices(tAnimationRig& rig) {
     tMat4f pose_matrix = tMat4f::transformation(bone.translation, tVec3f(1.f), bone.rotation);
     tMat4f bone_matrix = pose_matrix * inverse_bind_matrix;
 
-    active_pose.bone_matrices.push_back(bone_matrix.transpose());
+    active_pose.bone_matrices[i] = bone_matrix.transpose();
   }
 }
 
+/**
+ * Evaluates a batch of rigs across the job system's worker threads.
+ * Each rig only reads shared (read-only) animation data and writes
+ * to its own poses and bone matrices, so the rigs need no
+ * synchronization. All rigs are fully updated once this returns.
+ */
+void Animation::UpdateRigs(const std::vector<AnimationJob>& jobs, const float dt) {
+  profile("Animation::UpdateRigs()");
+
+  parallel_for((uint32)jobs.size(), [&](uint32 i) {
+    auto& job = jobs[i];
+    auto& rig = *job.rig;
+
+    Animation::AccumulateTime(rig, job.blend_rate, dt);
+    Animation::UpdatePose(rig, job.blend_type);
+    Animation::UpdateBoneMatrices(rig);
+  });
+}
+
 // @todo consolidate with below
 void Animation::SetNextAnimation(tAnimationRig& rig, tSkeletonAnimation* skeleton_animation) {
   if (rig.next_animation == skeleton_animation) {
@@ -371,7 +373,7 @@ float Animation::GetMaxTime(tSkeletonAnimation* animation) {
 }
 
 tVec3f Animation::GetRootMotion(tAnimationRig& rig) {
-  tVec3f initial_root = rig.current_animation->frames[0].bones[17].translation;
+  tVec3f initial_root = AnimationCache::SampleTranslation(*rig.current_animation, 17, 0, 0, 0.f);
   tVec3f current_root = GetSkeletonRootMotion(*rig.current_animation, rig.current_animation_time);
   tVec3f next_root = GetSkeletonRootMotion(*rig.next_animation, rig.next_animation_time);
   tVec3f blended_root = tVec3f::lerp(current_root, next_root, rig.next_animation_blend_alpha);
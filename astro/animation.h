@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "astro/game_state.h"
 
 namespace astro {
@@ -8,11 +10,18 @@ namespace astro {
     BLEND_EASE_IN_OUT
   };
 
+  struct AnimationJob {
+    tAnimationRig* rig = nullptr;
+    float blend_rate = 3.f;
+    AnimationBlendType blend_type = BLEND_LINEAR;
+  };
+
   // @todo move to engine (?)
   namespace Animation {
     void AccumulateTime(tAnimationRig& rig, const float blend_rate, const float dt);
     void UpdatePose(tAnimationRig& rig, const AnimationBlendType blend_type);
     void UpdateBoneMatrices(tAnimationRig& rig);
+    void UpdateRigs(const std::vector<AnimationJob>& jobs, const float dt);
     void SetNextAnimation(tAnimationRig& rig, tSkeletonAnimation* skeleton_animation);
     void StartNextAnimation(tAnimationRig& rig, tSkeletonAnimation* skeleton_animation);
     void AwaitNextAnimation(tAnimationRig& rig, tSkeletonAnimation* skeleton_animation);
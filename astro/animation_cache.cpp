@@ -0,0 +1,589 @@
+#include <filesystem>
+#include <fstream>
+#include <math.h>
+#include <string.h>
+
+#include "astro/animation_cache.h"
+
+using namespace astro;
+
+#define ANIMATION_CACHE_VERSION 2
+#define ANIMATION_CACHE_DIRECTORY "./astro/3d_skeleton_animations/.cache/"
+
+// Maximum angular error (in radians) tolerated when eliminating
+// constant rotation tracks or curve-fitting rotation keyframes
+constexpr static float ROTATION_TOLERANCE = 0.004f;
+// Maximum per-axis translation error tolerated when eliminating
+// constant translation tracks
+constexpr static float TRANSLATION_TOLERANCE = 0.0001f;
+constexpr static float QUANTIZATION_RANGE = 0.70710678f;
+// Maximum angular error (in radians) tolerated in decoded rotations,
+// leaving headroom over ROTATION_TOLERANCE for quantization error
+constexpr static float MAX_DECODING_ERROR = ROTATION_TOLERANCE + 0.001f;
+
+struct AnimationCacheHeader {
+  char magic[4] = { 'T', 'A', 'N', 'M' };
+  uint32 version = ANIMATION_CACHE_VERSION;
+  uint64 source_hash = 0;
+  uint16 total_frames = 0;
+  uint16 total_bones = 0;
+};
+
+static tQuantizedRotation QuantizeRotation(const Quaternion& rotation) {
+  Quaternion q = rotation.unit();
+  float components[4] = { q.x, q.y, q.z, q.w };
+  uint16 largest_index = 0;
+
+  for (uint16 i = 1; i < 4; i++) {
+    if (fabsf(components[i]) > fabsf(components[largest_index])) {
+      largest_index = i;
+    }
+  }
+
+  // q and -q represent the same rotation, so flip the quaternion
+  // as needed to keep the dropped component positive
+  float sign = components[largest_index] < 0.f ? -1.f : 1.f;
+  uint16 quantized[3];
+  uint16 q_index = 0;
+
+  for (uint16 i = 0; i < 4; i++) {
+    if (i == largest_index) continue;
+
+    float value = components[i] * sign / QUANTIZATION_RANGE;
+    if (value < -1.f) value = -1.f;
+    if (value > 1.f) value = 1.f;
+
+    quantized[q_index++] = uint16(roundf((value * 0.5f + 0.5f) * 32767.f));
+  }
+
+  tQuantizedRotation result;
+  result.a = quantized[0] | ((largest_index >> 1) << 15);
+  result.b = quantized[1] | ((largest_index & 1) << 15);
+  result.c = quantized[2];
+
+  return result;
+}
+
+static Quaternion DequantizeRotation(const tQuantizedRotation& rotation) {
+  uint16 largest_index = ((rotation.a >> 15) << 1) | (rotation.b >> 15);
+  uint16 quantized[3] = { uint16(rotation.a & 0x7FFF), uint16(rotation.b & 0x7FFF), rotation.c };
+  float components[4];
+  float sum = 0.f;
+  uint16 q_index = 0;
+
+  for (uint16 i = 0; i < 4; i++) {
+    if (i == largest_index) continue;
+
+    float value = (float(quantized[q_index++]) / 32767.f * 2.f - 1.f) * QUANTIZATION_RANGE;
+
+    components[i] = value;
+    sum += value * value;
+  }
+
+  components[largest_index] = sqrtf(sum < 1.f ? 1.f - sum : 0.f);
+
+  return Quaternion(components[3], components[0], components[1], components[2]);
+}
+
+static float GetRotationError(const Quaternion& q1, const Quaternion& q2) {
+  float d = fabsf(Quaternion::dot(q1.unit(), q2.unit()));
+  if (d > 1.f) d = 1.f;
+
+  return 2.f * acosf(d);
+}
+
+static bool IsWithinTranslationTolerance(const tVec3f& t1, const tVec3f& t2) {
+  return (
+    fabsf(t1.x - t2.x) <= TRANSLATION_TOLERANCE &&
+    fabsf(t1.y - t2.y) <= TRANSLATION_TOLERANCE &&
+    fabsf(t1.z - t2.z) <= TRANSLATION_TOLERANCE
+  );
+}
+
+static Quaternion SampleRotationTrack(const tCompressedAnimation& clip, const tAnimationTrack& track, const int32 frame) {
+  if (track.total_keys == 1) {
+    return DequantizeRotation(clip.rotation_keys[track.key_offset]);
+  }
+
+  uint16 last_key = track.key_offset + track.total_keys - 1;
+
+  for (uint16 k = track.key_offset; k < last_key; k++) {
+    int32 frame_a = clip.rotation_key_frames[k];
+    int32 frame_b = clip.rotation_key_frames[k + 1];
+
+    if (frame == frame_a) {
+      return DequantizeRotation(clip.rotation_keys[k]);
+    }
+
+    if (frame < frame_b) {
+      float alpha = float(frame - frame_a) / float(frame_b - frame_a);
+
+      return Quaternion::nlerp(
+        DequantizeRotation(clip.rotation_keys[k]),
+        DequantizeRotation(clip.rotation_keys[k + 1]),
+        alpha
+      );
+    }
+  }
+
+  return DequantizeRotation(clip.rotation_keys[last_key]);
+}
+
+static tVec3f SampleTranslationTrack(const tCompressedAnimation& clip, const tAnimationTrack& track, const int32 frame) {
+  if (track.total_keys == 1) {
+    return clip.translation_keys[track.key_offset];
+  }
+
+  return clip.translation_keys[track.key_offset + frame];
+}
+
+/**
+ * Greedily fits a rotation track to the fewest keyframes which
+ * reproduce every source frame within ROTATION_TOLERANCE, when
+ * interpolating between the retained keys. Constant tracks are
+ * reduced to a single key.
+ */
+static void AddRotationTrack(tCompressedAnimation& clip, const std::vector<tSkeleton>& frames, const uint32 bone_index) {
+  tAnimationTrack track;
+  track.key_offset = (uint16)clip.rotation_keys.size();
+
+  auto rotation_at = [&](size_t f) -> const Quaternion& {
+    return frames[f].bones[bone_index].rotation;
+  };
+
+  auto add_key = [&](size_t f) {
+    clip.rotation_keys.push_back(QuantizeRotation(rotation_at(f)));
+    clip.rotation_key_frames.push_back((uint16)f);
+    track.total_keys++;
+  };
+
+  bool is_constant = true;
+
+  for (size_t f = 1; f < frames.size(); f++) {
+    if (GetRotationError(rotation_at(0), rotation_at(f)) > ROTATION_TOLERANCE) {
+      is_constant = false;
+
+      break;
+    }
+  }
+
+  add_key(0);
+
+  if (!is_constant) {
+    size_t start = 0;
+    size_t end = 2;
+
+    while (end < frames.size()) {
+      bool can_skip_end = true;
+
+      // Check whether every frame between the last key and the
+      // candidate end frame can be reconstructed by interpolation
+      for (size_t f = start + 1; f < end; f++) {
+        float alpha = float(f - start) / float(end - start);
+        Quaternion fitted = Quaternion::nlerp(rotation_at(start), rotation_at(end), alpha);
+
+        if (GetRotationError(fitted, rotation_at(f)) > ROTATION_TOLERANCE) {
+          can_skip_end = false;
+
+          break;
+        }
+      }
+
+      if (!can_skip_end) {
+        add_key(end - 1);
+
+        start = end - 1;
+      }
+
+      end++;
+    }
+
+    add_key(frames.size() - 1);
+  }
+
+  clip.rotation_tracks.push_back(track);
+}
+
+static void AddTranslationTrack(tCompressedAnimation& clip, const std::vector<tSkeleton>& frames, const uint32 bone_index) {
+  tAnimationTrack track;
+  track.key_offset = (uint16)clip.translation_keys.size();
+
+  auto& initial_translation = frames[0].bones[bone_index].translation;
+  bool is_constant = true;
+
+  for (size_t f = 1; f < frames.size(); f++) {
+    if (!IsWithinTranslationTolerance(initial_translation, frames[f].bones[bone_index].translation)) {
+      is_constant = false;
+
+      break;
+    }
+  }
+
+  if (is_constant) {
+    clip.translation_keys.push_back(initial_translation);
+    track.total_keys = 1;
+  } else {
+    for (auto& frame : frames) {
+      clip.translation_keys.push_back(frame.bones[bone_index].translation);
+    }
+
+    track.total_keys = (uint16)frames.size();
+  }
+
+  clip.translation_tracks.push_back(track);
+}
+
+/**
+ * Builds the reference pose (the first frame) for an animation,
+ * which also serves as its initial evaluated pose.
+ */
+static void BuildReferencePose(tSkeletonAnimation& animation, const std::vector<std::string>& bone_names, const std::vector<int32>& parent_indexes, const std::vector<tVec3f>& bone_scales) {
+  auto& pose = animation.reference_pose;
+  auto& clip = animation.clip;
+
+  pose.bones.clear();
+  pose.name_to_index_map.clear();
+
+  for (size_t i = 0; i < bone_names.size(); i++) {
+    tBone bone;
+    bone.name = bone_names[i];
+    bone.index = (int32)i;
+    bone.parent_bone_index = parent_indexes[i];
+    bone.scale = bone_scales[i];
+    bone.rotation = SampleRotationTrack(clip, clip.rotation_tracks[i], 0);
+    bone.translation = SampleTranslationTrack(clip, clip.translation_tracks[i], 0);
+
+    pose.bones.push_back(bone);
+  }
+
+  for (auto& bone : pose.bones) {
+    if (bone.parent_bone_index != -1) {
+      pose.bones[bone.parent_bone_index].child_bone_indexes.push_back(bone.index);
+    }
+
+    pose.name_to_index_map[bone.name] = bone.index;
+  }
+
+  // Fallback case for unspecified bone names
+  pose.name_to_index_map["-"] = 0;
+}
+
+/**
+ * Hashes the contents of every source frame, in order, so cache
+ * files are invalidated exactly when the source data changes.
+ */
+static uint64 GetSourceHash(const std::vector<std::string>& frame_paths) {
+  // FNV-1a
+  uint64 hash = 14695981039346656037ULL;
+
+  for (auto& path : frame_paths) {
+    auto contents = Tachyon_GetBinaryFileContents(path.c_str());
+
+    for (char c : contents) {
+      hash ^= (uint8)c;
+      hash *= 1099511628211ULL;
+    }
+
+    // Separate frames, so moving bytes between files changes the hash
+    hash ^= 0xFF;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+static std::string GetCachePath(const std::vector<std::string>& frame_paths) {
+  auto directory = std::filesystem::path(frame_paths[0]).parent_path().filename().string();
+
+  return ANIMATION_CACHE_DIRECTORY + directory + ".anim";
+}
+
+template<typename T>
+static void WriteValue(std::string& buffer, const T& value) {
+  buffer.append((const char*)&value, sizeof(T));
+}
+
+template<typename T>
+static void WriteArray(std::string& buffer, const std::vector<T>& values) {
+  WriteValue(buffer, (uint32)values.size());
+
+  buffer.append((const char*)values.data(), values.size() * sizeof(T));
+}
+
+template<typename T>
+static bool ReadValue(const std::string& buffer, size_t& offset, T& value) {
+  if (offset + sizeof(T) > buffer.size()) {
+    return false;
+  }
+
+  memcpy(&value, buffer.data() + offset, sizeof(T));
+  offset += sizeof(T);
+
+  return true;
+}
+
+template<typename T>
+static bool ReadArray(const std::string& buffer, size_t& offset, std::vector<T>& values) {
+  uint32 total = 0;
+
+  if (!ReadValue(buffer, offset, total) || offset + total * sizeof(T) > buffer.size()) {
+    return false;
+  }
+
+  values.resize(total);
+  memcpy(values.data(), buffer.data() + offset, total * sizeof(T));
+  offset += total * sizeof(T);
+
+  return true;
+}
+
+static void SaveCacheFile(const std::string& cache_path, const AnimationCacheHeader& header, const tSkeletonAnimation& animation) {
+  std::string buffer;
+
+  WriteValue(buffer, header);
+
+  for (auto& bone : animation.reference_pose.bones) {
+    WriteValue(buffer, (uint8)bone.name.size());
+    buffer.append(bone.name);
+    WriteValue(buffer, bone.parent_bone_index);
+    WriteValue(buffer, bone.scale);
+  }
+
+  auto& clip = animation.clip;
+
+  WriteArray(buffer, clip.rotation_tracks);
+  WriteArray(buffer, clip.translation_tracks);
+  WriteArray(buffer, clip.rotation_keys);
+  WriteArray(buffer, clip.rotation_key_frames);
+  WriteArray(buffer, clip.translation_keys);
+
+  std::error_code error;
+  std::filesystem::create_directories(ANIMATION_CACHE_DIRECTORY, error);
+
+  std::ofstream file(cache_path, std::ios::out | std::ios::binary);
+
+  if (file.fail()) {
+    printf("[AnimationCache] Failed to write cache file: %s\n", cache_path.c_str());
+
+    return;
+  }
+
+  file.write(buffer.data(), buffer.size());
+  file.close();
+}
+
+static bool LoadCacheFile(const std::string& cache_path, const uint64 source_hash, tSkeletonAnimation& animation) {
+  std::ifstream file(cache_path, std::ios::in | std::ios::binary);
+
+  if (file.fail()) {
+    return false;
+  }
+
+  std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  size_t offset = 0;
+  AnimationCacheHeader header;
+  AnimationCacheHeader expected_header;
+
+  file.close();
+
+  if (
+    !ReadValue(buffer, offset, header) ||
+    memcmp(header.magic, expected_header.magic, 4) != 0 ||
+    header.version != ANIMATION_CACHE_VERSION ||
+    header.source_hash != source_hash
+  ) {
+    // Stale or invalid cache file
+    return false;
+  }
+
+  std::vector<std::string> bone_names(header.total_bones);
+  std::vector<int32> parent_indexes(header.total_bones);
+  std::vector<tVec3f> bone_scales(header.total_bones);
+
+  for (uint16 i = 0; i < header.total_bones; i++) {
+    uint8 name_length = 0;
+
+    if (!ReadValue(buffer, offset, name_length) || offset + name_length > buffer.size()) {
+      return false;
+    }
+
+    bone_names[i] = buffer.substr(offset, name_length);
+    offset += name_length;
+
+    if (
+      !ReadValue(buffer, offset, parent_indexes[i]) ||
+      !ReadValue(buffer, offset, bone_scales[i])
+    ) {
+      return false;
+    }
+  }
+
+  auto& clip = animation.clip;
+
+  if (
+    !ReadArray(buffer, offset, clip.rotation_tracks) ||
+    !ReadArray(buffer, offset, clip.translation_tracks) ||
+    !ReadArray(buffer, offset, clip.rotation_keys) ||
+    !ReadArray(buffer, offset, clip.rotation_key_frames) ||
+    !ReadArray(buffer, offset, clip.translation_keys) ||
+    clip.rotation_tracks.size() != header.total_bones ||
+    clip.translation_tracks.size() != header.total_bones
+  ) {
+    return false;
+  }
+
+  animation.total_frames = header.total_frames;
+
+  BuildReferencePose(animation, bone_names, parent_indexes, bone_scales);
+
+  return true;
+}
+
+/**
+ * Compares every decoded keyframe against its source frame,
+ * returning the maximum rotation error in radians.
+ */
+static float GetMaxDecodingError(const tSkeletonAnimation& animation, const std::vector<tSkeleton>& frames) {
+  auto& clip = animation.clip;
+  float max_error = 0.f;
+
+  for (size_t f = 0; f < frames.size(); f++) {
+    for (size_t i = 0; i < frames[f].bones.size(); i++) {
+      Quaternion decoded = SampleRotationTrack(clip, clip.rotation_tracks[i], (int32)f);
+      float error = GetRotationError(decoded, frames[f].bones[i].rotation);
+
+      if (error > max_error) {
+        max_error = error;
+      }
+    }
+  }
+
+  return max_error;
+}
+
+static size_t GetCompressedSize(const tSkeletonAnimation& animation) {
+  auto& clip = animation.clip;
+
+  return (
+    clip.rotation_tracks.size() * sizeof(tAnimationTrack) +
+    clip.translation_tracks.size() * sizeof(tAnimationTrack) +
+    clip.rotation_keys.size() * sizeof(tQuantizedRotation) +
+    clip.rotation_key_frames.size() * sizeof(uint16) +
+    clip.translation_keys.size() * sizeof(tVec3f)
+  );
+}
+
+static size_t GetUncompressedSize(const tSkeletonAnimation& animation) {
+  return animation.total_frames * animation.reference_pose.bones.size() * sizeof(tBone);
+}
+
+void AnimationCache::LoadAnimation(tSkeletonAnimation& animation, const std::vector<std::string>& frame_paths) {
+  auto start_time = Tachyon_GetMicroseconds();
+  auto cache_path = GetCachePath(frame_paths);
+  auto source_hash = GetSourceHash(frame_paths);
+
+  animation.clip = tCompressedAnimation();
+
+  if (LoadCacheFile(cache_path, source_hash, animation)) {
+    auto duration = Tachyon_GetMicroseconds() - start_time;
+
+    printf(
+      "[AnimationCache] Loaded %s (%d frames, %zu bytes, was %zu) in %.2fms\n",
+      cache_path.c_str(),
+      animation.total_frames,
+      GetCompressedSize(animation),
+      GetUncompressedSize(animation),
+      float(duration) / 1000.f
+    );
+
+    return;
+  }
+
+  // No up-to-date cache file, so parse the source frames and compress them
+  std::vector<tSkeleton> frames;
+
+  for (auto& path : frame_paths) {
+    frames.push_back(GltfLoader(path.c_str()).skeleton);
+  }
+
+  auto& reference = frames[0];
+  std::vector<std::string> bone_names;
+  std::vector<int32> parent_indexes;
+  std::vector<tVec3f> bone_scales;
+
+  for (auto& bone : reference.bones) {
+    bone_names.push_back(bone.name);
+    parent_indexes.push_back(bone.parent_bone_index);
+    bone_scales.push_back(bone.scale);
+  }
+
+  for (uint32 i = 0; i < reference.bones.size(); i++) {
+    AddRotationTrack(animation.clip, frames, i);
+    AddTranslationTrack(animation.clip, frames, i);
+  }
+
+  animation.total_frames = (uint16)frames.size();
+
+  BuildReferencePose(animation, bone_names, parent_indexes, bone_scales);
+
+  float max_error = GetMaxDecodingError(animation, frames);
+
+  if (max_error > MAX_DECODING_ERROR) {
+    printf("[AnimationCache] Fatal Error: %s decodes with %.5f rad of rotation error (max %.5f)\n", cache_path.c_str(), max_error, MAX_DECODING_ERROR);
+
+    throw new std::exception("Error");
+    exit(0);
+  }
+
+  AnimationCacheHeader header;
+  header.source_hash = source_hash;
+  header.total_frames = animation.total_frames;
+  header.total_bones = (uint16)reference.bones.size();
+
+  SaveCacheFile(cache_path, header, animation);
+
+  auto duration = Tachyon_GetMicroseconds() - start_time;
+
+  printf(
+    "[AnimationCache] Built %s (%d frames, %zu rotation keys, %zu bytes, was %zu, max error %.5f rad) in %.2fms\n",
+    cache_path.c_str(),
+    animation.total_frames,
+    animation.clip.rotation_keys.size(),
+    GetCompressedSize(animation),
+    GetUncompressedSize(animation),
+    max_error,
+    float(duration) / 1000.f
+  );
+}
+
+void AnimationCache::SampleRotations(const tSkeletonAnimation& animation, const int32 frame_a, const int32 frame_b, const float alpha, tSkeleton& pose) {
+  auto& clip = animation.clip;
+
+  for (size_t i = 0; i < clip.rotation_tracks.size(); i++) {
+    auto& track = clip.rotation_tracks[i];
+
+    if (track.total_keys == 1) {
+      pose.bones[i].rotation = DequantizeRotation(clip.rotation_keys[track.key_offset]);
+    } else {
+      Quaternion rotation_a = SampleRotationTrack(clip, track, frame_a);
+      Quaternion rotation_b = SampleRotationTrack(clip, track, frame_b);
+
+      pose.bones[i].rotation = Quaternion::nlerp(rotation_a, rotation_b, alpha);
+    }
+  }
+}
+
+tVec3f AnimationCache::SampleTranslation(const tSkeletonAnimation& animation, const uint32 bone_index, const int32 frame_a, const int32 frame_b, const float alpha) {
+  auto& clip = animation.clip;
+  auto& track = clip.translation_tracks[bone_index];
+
+  if (track.total_keys == 1) {
+    return clip.translation_keys[track.key_offset];
+  }
+
+  return tVec3f::lerp(
+    SampleTranslationTrack(clip, track, frame_a),
+    SampleTranslationTrack(clip, track, frame_b),
+    alpha
+  );
+}
\ No newline at end of file
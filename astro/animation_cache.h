@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "engine/tachyon.h"
+#include "astro/game_state.h"
+
+namespace astro {
+  namespace AnimationCache {
+    void LoadAnimation(tSkeletonAnimation& animation, const std::vector<std::string>& frame_paths);
+    void SampleRotations(const tSkeletonAnimation& animation, const int32 frame_a, const int32 frame_b, const float alpha, tSkeleton& pose);
+    tVec3f SampleTranslation(const tSkeletonAnimation& animation, const uint32 bone_index, const int32 frame_a, const int32 frame_b, const float alpha);
+  }
+}
\ No newline at end of file
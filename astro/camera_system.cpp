@@ -140,7 +140,7 @@ void CameraSystem::UpdateCamera(Tachyon* tachyon, State& state) {
   // @todo formalize special camera modes
   {
     for (auto& entity : state.npcs) {
-      if (entity.unique_name == "lake_girl") {
+      if (entity.unique_name_symbol == state.name_symbols.lake_girl) {
         // if (abs(entity.position.y - state.player_position.y) > 250.f) continue;
 
         float distance = tVec3f::distance(state.player_position, entity.position);
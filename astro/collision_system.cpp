@@ -981,9 +981,13 @@ void CollisionSystem::RebuildFlatGroundPlanes(Tachyon* tachyon, State& state) {
 }
 
 float CollisionSystem::QueryGroundHeight(State& state, const float x, const float z) {
+  return QueryGroundHeight(state.flat_ground_planes, x, z);
+}
+
+float CollisionSystem::QueryGroundHeight(const std::vector<Plane>& flat_ground_planes, const float x, const float z) {
   tVec3f point = tVec3f(x, 0.f, z);
 
-  for (auto& plane : state.flat_ground_planes) {
+  for (auto& plane : flat_ground_planes) {
     if (CollisionSystem::IsPointOnPlane(point, plane)) {
       return plane.p1.y;
     }
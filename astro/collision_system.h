@@ -9,6 +9,7 @@ namespace astro {
     bool IsPointOnPlane(const tVec3f& point, const Plane& plane);
     void RebuildFlatGroundPlanes(Tachyon* tachyon, State& state);
     float QueryGroundHeight(State& state, const float x, const float z);
+    float QueryGroundHeight(const std::vector<Plane>& flat_ground_planes, const float x, const float z);
     void HandleCollisions(Tachyon* Tachyon, State& state);
   }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "astro/data_loader.h"
+#include "astro/edit_journal.h"
 #include "astro/entity_dispatcher.h"
 #include "astro/entity_manager.h"
 
@@ -28,7 +29,7 @@ static std::vector<std::string> SplitString(const std::string& str, const std::s
   return values;
 }
 
-static EntityType EntityNameToType(const std::string& entity_name) {
+EntityType DataLoader::EntityNameToType(const std::string& entity_name) {
   for (auto& [entity_type, entity_defaults] : entity_defaults_map) {
     if (entity_defaults.name == entity_name) {
       return entity_type;
@@ -93,6 +94,8 @@ void DataLoader::LoadLevelData(Tachyon* tachyon, State& state) {
   auto lines = SplitString(level_data, "\n");  // @allocation
 
   EntityType current_entity_type = UNSPECIFIED;
+  // The last level journal operation written into the level file
+  uint32 compacted_sequence = 0;
 
   #define parsef(i) stof(parts[i])
   #define parse_bool(i) (i == "1")
@@ -103,6 +106,13 @@ void DataLoader::LoadLevelData(Tachyon* tachyon, State& state) {
     if (line.size() == 0) continue;  // Empty line
     if (line[0] == '=') continue;    // Demarcation line
 
+    // Compacted journal sequence number
+    if (line[0] == '#') {
+      compacted_sequence = stoi(line.substr(1));
+
+      continue;
+    }
+
     // Object
     if (line[0] == '$') {
       auto parts = SplitString(line, ",");  // @allocation
@@ -205,6 +215,9 @@ void DataLoader::LoadLevelData(Tachyon* tachyon, State& state) {
   #undef parse_bool
   #undef parse_vec3f
   #undef parse_quaternion
+
+  // Apply edits saved since the level file was last written
+  EditJournal::ReplayLevelJournal(tachyon, state, compacted_sequence);
 }
 
 void DataLoader::LoadNpcDialogue(Tachyon* tachyon, State& state) {
@@ -10,5 +10,6 @@ namespace astro {
     void LoadCameraData(Tachyon* tachyon, State& state);
     uint16 MeshIndexToId(State& state, uint16 mesh_index);
     uint16 MeshIdToIndex(State& state, uint16 mesh_id);
+    EntityType EntityNameToType(const std::string& entity_name);
   }
 }
\ No newline at end of file
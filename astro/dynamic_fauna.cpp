@@ -13,32 +13,36 @@ using namespace astro;
  * -----------
  */
 static void SpawnButterfly(Tachyon* tachyon, State& state, const tVec3f& position) {
-  auto& meshes = state.meshes;
-
-  Butterfly butterfly;
-  butterfly.position = position;
-  butterfly.direction = tVec3f(0, 0, -1.f);
-  butterfly.left_wing = create(meshes.butterfly_left_wing).object_id;
-  butterfly.right_wing = create(meshes.butterfly_right_wing).object_id;
-  butterfly.state = Butterfly::TURNING_LEFT;
+  auto& butterflies = state.butterflies;
 
-  state.butterflies.push_back(butterfly);
+  butterflies.positions.push_back(position);
+  butterflies.directions.push_back(tVec3f(0, 0, -1.f));
+  butterflies.states.push_back(BUTTERFLY_TURNING_LEFT);
+  butterflies.last_state_change_times.push_back(0.f);
 }
 
-static void DestroyButterfly(Tachyon* tachyon, State& state, int32 index) {
-  auto& meshes = state.meshes;
-  auto& butterfly = state.butterflies[index];
+static void DestroyButterfly(Tachyon* tachyon, State& state, uint32 index) {
+  auto& butterflies = state.butterflies;
+  uint32 last = (uint32)butterflies.positions.size() - 1;
 
-  remove_object(meshes.butterfly_left_wing, butterfly.left_wing);
-  remove_object(meshes.butterfly_right_wing, butterfly.right_wing);
+  // Swap with the last butterfly, so removal is O(1)
+  if (index != last) {
+    butterflies.positions[index] = butterflies.positions[last];
+    butterflies.directions[index] = butterflies.directions[last];
+    butterflies.states[index] = butterflies.states[last];
+    butterflies.last_state_change_times[index] = butterflies.last_state_change_times[last];
+  }
 
-  state.butterflies.erase(state.butterflies.begin() + index);
+  butterflies.positions.pop_back();
+  butterflies.directions.pop_back();
+  butterflies.states.pop_back();
+  butterflies.last_state_change_times.pop_back();
 }
 
 static void HandleButterflySpawningBehavior(Tachyon* tachyon, State& state) {
   auto& meshes = state.meshes;
 
-  while (state.butterflies.size() < 5) {
+  while (state.butterflies.positions.size() < 5) {
     tVec3f offset;
     offset.x = Tachyon_GetRandom() > 0.5f ? -15000.f : 15000.f;
     offset.y = 1000.f;
@@ -50,125 +54,163 @@ static void HandleButterflySpawningBehavior(Tachyon* tachyon, State& state) {
   }
 }
 
-static void HandleButterfly(Tachyon* tachyon, State& state, Butterfly& butterfly) {
-  auto& meshes = state.meshes;
+static void UpdateButterflies(Tachyon* tachyon, State& state) {
+  auto& butterflies = state.butterflies;
+  auto& positions = butterflies.positions;
+  auto& directions = butterflies.directions;
+  auto& states = butterflies.states;
+  auto& last_state_change_times = butterflies.last_state_change_times;
+  uint32 total_butterflies = (uint32)positions.size();
   float scene_time = get_scene_time();
+  float speed = 1000.f + state.astro_turn_speed * 100000.f;
 
-  auto& left_wing = objects(meshes.butterfly_left_wing).getByIdFast(butterfly.left_wing);
-  auto& right_wing = objects(meshes.butterfly_right_wing).getByIdFast(butterfly.right_wing);
+  const float separation_radius = 2000.f;
 
-  // Periodically changing direction
-  {
-    if (time_since(butterfly.last_state_change_time) > 1.f) {
-      float random = Tachyon_GetRandom();
+  Tachyon_BuildSpatialGrid(butterflies.grid, positions, separation_radius);
 
-      if (random < 0.33f) {
-        butterfly.state = Butterfly::State::TURNING_LEFT;
-      }
-      else if (random < 0.66f) {
-        butterfly.state = Butterfly::State::TURNING_RIGHT;
-      }
-      else {
-        butterfly.state = Butterfly::State::FLYING_STRAIGHT;
+  static std::vector<uint32> neighbors;
+
+  for (uint32 i = 0; i < total_butterflies; i++) {
+    auto& direction = directions[i];
+
+    // Periodically changing direction
+    {
+      if (time_since(last_state_change_times[i]) > 1.f) {
+        float random = Tachyon_GetRandom();
+
+        if (random < 0.33f) {
+          states[i] = BUTTERFLY_TURNING_LEFT;
+        }
+        else if (random < 0.66f) {
+          states[i] = BUTTERFLY_TURNING_RIGHT;
+        }
+        else {
+          states[i] = BUTTERFLY_FLYING_STRAIGHT;
+        }
+
+        last_state_change_times[i] = scene_time;
       }
+    }
 
-      butterfly.last_state_change_time = scene_time;
+    // Avoiding collision with the player + taller objects
+    {
+      // @todo
     }
-  }
 
-  // Avoiding collision with the player + taller objects
-  {
-    // @todo
-  }
+    // Handling direction
+    {
+      switch (states[i]) {
+        case BUTTERFLY_TURNING_LEFT: {
+          tVec3f left = tVec3f::cross(direction, tVec3f(0, 1.f, 0)).invert();
 
-  // Handling direction
-  {
-    switch (butterfly.state) {
-      case Butterfly::State::TURNING_LEFT: {
-        tVec3f left = tVec3f::cross(butterfly.direction, tVec3f(0, 1.f, 0)).invert();
-        tVec3f new_direction = tVec3f::lerp(butterfly.direction, left, state.dt).unit();
+          direction = tVec3f::lerp(direction, left, state.dt).unit();
+
+          break;
+        }
+
+        case BUTTERFLY_TURNING_RIGHT: {
+          tVec3f right = tVec3f::cross(direction, tVec3f(0, 1.f, 0));
 
-        butterfly.direction = new_direction;
+          direction = tVec3f::lerp(direction, right, state.dt).unit();
 
-        break;
+          break;
+        }
+
+        case BUTTERFLY_FLYING_STRAIGHT:
+          break;
       }
+    }
+
+    // Steering away from nearby butterflies
+    {
+      Tachyon_QuerySpatialGrid(butterflies.grid, positions[i], separation_radius, neighbors);
 
-      case Butterfly::State::TURNING_RIGHT: {
-        tVec3f right = tVec3f::cross(butterfly.direction, tVec3f(0, 1.f, 0));
-        tVec3f new_direction = tVec3f::lerp(butterfly.direction, right, state.dt).unit();
+      tVec3f separation;
 
-        butterfly.direction = new_direction;
+      for (auto neighbor : neighbors) {
+        if (neighbor == i) continue;
 
-        break;
+        separation += (positions[i] - positions[neighbor]).xz();
       }
 
-      case Butterfly::State::FLYING_STRAIGHT:
-        break;
+      if (separation.magnitude() > 0.f) {
+        direction = tVec3f::lerp(direction, separation.unit(), state.dt).unit();
+      }
     }
-  }
 
-  // Flapping wings
-  {
-    float angle = 0.4f * sinf(25.f * scene_time);
+    // Updating position
+    {
+      positions[i] += direction * speed * state.dt;
 
-    left_wing.rotation = Quaternion::fromAxisAngle(tVec3f(0, 0, 1.f), angle);
-    right_wing.rotation = Quaternion::fromAxisAngle(tVec3f(0, 0, 1.f), -angle);
+      // Oscillation
+      positions[i] += 400.f * sinf(2.f * scene_time) * state.dt;
+    }
   }
+}
 
-  // Updating rotation
-  {
-    Quaternion facing_rotation = Quaternion::FromDirection(butterfly.direction, tVec3f(0, 1.f, 0));
+/**
+ * Writes every butterfly's wings into the wing meshes' instances
+ * in one pass, rather than creating and removing objects per butterfly.
+ * The wing pools grow to fit however many butterflies there are.
+ */
+static void UpdateButterflyInstances(Tachyon* tachyon, State& state) {
+  auto& meshes = state.meshes;
+  auto& butterflies = state.butterflies;
+  float scene_time = get_scene_time();
 
-    left_wing.rotation *= facing_rotation;
-    right_wing.rotation *= facing_rotation;
+  while (objects(meshes.butterfly_left_wing).total_active < butterflies.positions.size()) {
+    create(meshes.butterfly_left_wing);
+    create(meshes.butterfly_right_wing);
   }
 
-  // Updating position
-  {
-    float speed = 1000.f + state.astro_turn_speed * 100000.f;
+  reset_instances(meshes.butterfly_left_wing);
+  reset_instances(meshes.butterfly_right_wing);
 
-    butterfly.position += butterfly.direction * speed * state.dt;
+  // Flapping wings
+  float angle = 0.4f * sinf(25.f * scene_time);
+  Quaternion left_wing_flap = Quaternion::fromAxisAngle(tVec3f(0, 0, 1.f), angle);
+  Quaternion right_wing_flap = Quaternion::fromAxisAngle(tVec3f(0, 0, 1.f), -angle);
 
-    // Oscillation
-    butterfly.position += 400.f * sinf(2.f * scene_time) * state.dt;
-  }
+  for (size_t i = 0; i < butterflies.positions.size(); i++) {
+    auto& left_wing = use_instance(meshes.butterfly_left_wing);
+    auto& right_wing = use_instance(meshes.butterfly_right_wing);
 
-  // Updating properties
-  {
-    left_wing.position = butterfly.position;
+    Quaternion facing_rotation = Quaternion::FromDirection(butterflies.directions[i], tVec3f(0, 1.f, 0));
+
+    left_wing.position = butterflies.positions[i];
+    left_wing.rotation = left_wing_flap * facing_rotation;
     left_wing.color = tVec4f(1.f, 0.7f, 0.7f, 0.4f);
     left_wing.scale = tVec3f(150.f);
     left_wing.material = tVec4f(0.8f, 0, 0, 1.f);
 
-    right_wing.position = butterfly.position;
+    right_wing.position = butterflies.positions[i];
+    right_wing.rotation = right_wing_flap * facing_rotation;
     right_wing.color = tVec4f(1.f, 0.7f, 0.7f, 0.4f);
     right_wing.scale = tVec3f(150.f);
     right_wing.material = tVec4f(0.8f, 0, 0, 1.f);
-  }
 
-  commit(left_wing);
-  commit(right_wing);
+    commit(left_wing);
+    commit(right_wing);
+  }
 }
 
 static void HandleButterflies(Tachyon* tachyon, State& state) {
-  HandleButterflySpawningBehavior(tachyon, state);
+  auto& positions = state.butterflies.positions;
 
-  // Behavior
-  for (auto& butterfly : state.butterflies) {
-    HandleButterfly(tachyon, state, butterfly);
-  }
+  HandleButterflySpawningBehavior(tachyon, state);
+  UpdateButterflies(tachyon, state);
 
   // Destruction
-  for (int32 i = state.butterflies.size() - 1; i >= 0; i--) {
-    auto& butterfly = state.butterflies[i];
-
+  for (int32 i = (int32)positions.size() - 1; i >= 0; i--) {
     if (
-      abs(state.player_position.x - butterfly.position.x) > 20000.f ||
-      abs(state.player_position.z - butterfly.position.z) > 20000.f
+      abs(state.player_position.x - positions[i].x) > 20000.f ||
+      abs(state.player_position.z - positions[i].z) > 20000.f
     ) {
       DestroyButterfly(tachyon, state, i);
     }
   }
+
+  UpdateButterflyInstances(tachyon, state);
 }
 
 /**
@@ -263,14 +305,37 @@ static void SpawnTinyBird(Tachyon* tachyon, State& state, const GameEntity& spaw
   }
 }
 
+static void UpdateBirdSpawnGrid(State& state) {
+  auto& grid = state.bird_spawn_grid;
+
+  if (grid.points.size() == state.bird_spawns.size()) return;
+
+  std::vector<tVec3f> positions;
+  positions.reserve(state.bird_spawns.size());
+
+  for_entities(state.bird_spawns) {
+    positions.push_back(state.bird_spawns[i].position);
+  }
+
+  Tachyon_BuildSpatialGrid(grid, positions, 5000.f);
+}
+
 static void HandleTinyBirdSpawningBehavior(Tachyon* tachyon, State& state, const float player_speed) {
   float last_spawn_time = time_since(state.last_tiny_bird_spawn_time);
 
   if (last_spawn_time < state.tiny_bird_cooldown_time) return;
   if (abs(state.astro_turn_speed) != 0.f) return;
 
-  for_entities(state.bird_spawns) {
-    auto& entity = state.bird_spawns[i];
+  UpdateBirdSpawnGrid(state);
+
+  // Only consider spawns within the x/z range checked below,
+  // regardless of their height relative to the player
+  static std::vector<uint32> nearby_spawns;
+
+  Tachyon_QuerySpatialGridBox(state.bird_spawn_grid, state.player_position, 20000.f, nearby_spawns);
+
+  for (auto index : nearby_spawns) {
+    auto& entity = state.bird_spawns[index];
 
     if (state.tiny_birds.size() >= 10) break;
     if (!IsDuringActiveTime(entity, state)) continue;
@@ -678,7 +743,9 @@ static void HandleTinyBirds(Tachyon* tachyon, State& state) {
       abs(bird.position.z - state.player_position.z) > 25000.f ||
       state.astro_turn_speed != 0.f
     ) {
-      birds.erase(birds.begin() + i);
+      // Swap-remove; birds are re-instanced every frame, so order doesn't matter
+      birds[i] = birds.back();
+      birds.pop_back();
     }
   }
 }
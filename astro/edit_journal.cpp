@@ -0,0 +1,884 @@
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "astro/edit_journal.h"
+#include "astro/data_loader.h"
+#include "astro/decorative_meshes.h"
+#include "astro/entity_dispatcher.h"
+#include "astro/entity_manager.h"
+
+using namespace astro;
+
+#define LEVEL_FILE_PATH "./astro/level_data/overworld.txt"
+#define LEVEL_JOURNAL_PATH "./astro/level_data/overworld.journal"
+
+// Journals larger than this are compacted into the level file
+// the next time the level is saved
+constexpr static uint32 MAX_JOURNAL_SIZE = 64 * 1024;
+
+/**
+ * ----------------------------
+ * A copy of the saved properties of every entity and decorative
+ * object, taken when compacting, so the level file can be written
+ * without touching live level data.
+ * ----------------------------
+ */
+struct LevelSnapshot {
+  std::vector<std::string> entity_type_names;
+  std::vector<std::vector<LevelRecord>> entities;
+  std::vector<LevelRecord> objects;
+  std::vector<uint16> object_mesh_ids;
+  // The last journaled operation included in the snapshot
+  uint32 sequence = 0;
+  // The size of the journal when the snapshot was taken
+  uint32 journal_size = 0;
+};
+
+// Guards the journal file, which is appended to on the main thread
+// and cleared by the compaction thread
+static std::mutex journal_mutex;
+static uint32 journal_size = 0;
+static uint32 next_sequence = 1;
+
+/**
+ * ----------------------------
+ * The thread compacting the most recent level snapshot into the
+ * level file. Joined before starting another compaction and at exit,
+ * so writes are never cut off part of the way through.
+ * ----------------------------
+ */
+static struct LevelSaveWorker {
+  std::thread thread;
+
+  void join() {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  ~LevelSaveWorker() {
+    join();
+  }
+} save_worker;
+
+static std::string GetEntityTypeName(EntityType type) {
+  auto entry = entity_defaults_map.find(type);
+
+  if (entry != entity_defaults_map.end()) {
+    return entry->second.name;
+  }
+
+  return "(MISSING ENTITY DEFAULTS)";
+}
+
+/**
+ * ----------------------------
+ * Serialization helpers for different data types.
+ * ----------------------------
+ */
+static inline std::string Serialize(float f) {
+  return std::format("{:.3f}", f);
+}
+
+static inline std::string Serialize(bool value) {
+  return value ? "1" : "";
+}
+
+static inline std::string Serialize(const tVec3f& vector) {
+  return (
+    Serialize(vector.x) + "," +
+    Serialize(vector.y) + "," +
+    Serialize(vector.z)
+  );
+}
+
+static inline std::string Serialize(const Quaternion& quaternion) {
+  return (
+    Serialize(quaternion.w) + "," +
+    Serialize(quaternion.x) + "," +
+    Serialize(quaternion.y) + "," +
+    Serialize(quaternion.z)
+  );
+}
+
+static inline std::string Serialize(const tColor& color) {
+  return std::to_string(color.rgba);
+}
+
+/**
+ * ----------------------------
+ * Converts an entity record into a condensed string representation
+ * for storage in a level data file.
+ * ----------------------------
+ */
+static std::string SerializeEntity(const LevelRecord& record) {
+  return (
+    Serialize(record.position) + "," +
+    Serialize(record.scale) + "," +
+    Serialize(record.rotation) + "," +
+    Serialize(record.tint) + "," +
+    Serialize(record.astro_start_time) + "," +
+    Serialize(record.astro_end_time) + "," +
+    record.item_pickup_name + "," +
+    record.unique_name + "," +
+    record.associated_entity_name + "," +
+    Serialize(record.requires_action)
+  );
+}
+
+/**
+ * ----------------------------
+ * Converts an object record into a condensed string representation
+ * for storage in a level data file.
+ * ----------------------------
+ */
+static std::string SerializeObject(const LevelRecord& record, const uint16 mesh_id) {
+  return (
+    "$" +
+    std::to_string(mesh_id) + "," +
+    Serialize(record.position) + "," +
+    Serialize(record.scale) + "," +
+    Serialize(record.rotation) + "," +
+    Serialize(record.color)
+  );
+}
+
+/**
+ * ----------------------------
+ * Copies the saved properties of all entities and objects in the level.
+ * ----------------------------
+ */
+static std::shared_ptr<LevelSnapshot> CreateLevelSnapshot(Tachyon* tachyon, State& state) {
+  auto snapshot = std::make_shared<LevelSnapshot>();
+
+  for_all_entity_types() {
+    auto& records = snapshot->entities.emplace_back();
+
+    snapshot->entity_type_names.push_back(GetEntityTypeName(type));
+
+    for_entities_of_type(type) {
+      records.push_back(EditJournal::GetLevelRecord(entities[i]));
+    }
+  }
+
+  for (auto& decorative : GetDecorativeMeshes(state)) {
+    auto& objects = objects(decorative.mesh_index);
+    uint16 mesh_id = DataLoader::MeshIndexToId(state, decorative.mesh_index);
+
+    // Perform a sequence-preserving loop over the objects
+    // to ensure they always serialize in the same order
+    // (e.g. if objects are removed/shuffled during runtime)
+    for (uint16 id = 0; id <= objects.highest_used_id; id++) {
+      tObject* object = objects.getById(id);
+
+      if (object != nullptr) {
+        snapshot->objects.push_back(EditJournal::GetLevelRecord(*object));
+        snapshot->object_mesh_ids.push_back(mesh_id);
+      }
+    }
+  }
+
+  return snapshot;
+}
+
+/**
+ * ----------------------------
+ * Binary serialization helpers for journaled operations.
+ * ----------------------------
+ */
+template<typename T>
+static inline void Write(std::string& data, const T& value) {
+  data.append((const char*)&value, sizeof(T));
+}
+
+static inline void Write(std::string& data, const std::string& value) {
+  Write(data, (uint16)value.size());
+
+  data.append(value);
+}
+
+static inline void Write(std::string& data, const tVec3f& vector) {
+  Write(data, vector.x);
+  Write(data, vector.y);
+  Write(data, vector.z);
+}
+
+static inline void Write(std::string& data, const Quaternion& quaternion) {
+  Write(data, quaternion.w);
+  Write(data, quaternion.x);
+  Write(data, quaternion.y);
+  Write(data, quaternion.z);
+}
+
+/**
+ * ----------------------------
+ * Reads values back out of a journal, in the order they were written.
+ * Flags a read past the end of the journal (e.g. if the game stopped
+ * while an operation was being appended) instead of reading it.
+ * ----------------------------
+ */
+struct JournalReader {
+  const std::string& data;
+  size_t offset = 0;
+  bool is_truncated = false;
+
+  template<typename T>
+  T read() {
+    T value = T();
+
+    if (offset + sizeof(T) > data.size()) {
+      is_truncated = true;
+    } else {
+      memcpy(&value, data.data() + offset, sizeof(T));
+    }
+
+    offset += sizeof(T);
+
+    return value;
+  }
+
+  std::string read_string() {
+    uint16 length = read<uint16>();
+
+    if (offset + length > data.size()) {
+      is_truncated = true;
+
+      return "";
+    }
+
+    std::string value = data.substr(offset, length);
+
+    offset += length;
+
+    return value;
+  }
+
+  tVec3f read_vec3f() {
+    float x = read<float>();
+    float y = read<float>();
+    float z = read<float>();
+
+    return tVec3f(x, y, z);
+  }
+
+  Quaternion read_quaternion() {
+    float w = read<float>();
+    float x = read<float>();
+    float y = read<float>();
+    float z = read<float>();
+
+    return Quaternion(w, x, y, z);
+  }
+};
+
+/**
+ * ----------------------------
+ * Entity types are written by name, and meshes by their level
+ * file ID, so journals survive changes to either enumeration.
+ * ----------------------------
+ */
+static void WriteLevelRecord(State& state, std::string& data, const LevelRecord& record) {
+  Write(data, (uint8)record.is_entity);
+  Write(data, record.position);
+  Write(data, record.scale);
+  Write(data, record.rotation);
+
+  if (record.is_entity) {
+    Write(data, GetEntityTypeName(record.entity_type));
+    Write(data, record.tint);
+    Write(data, record.astro_start_time);
+    Write(data, record.astro_end_time);
+    Write(data, record.item_pickup_name);
+    Write(data, record.unique_name);
+    Write(data, record.associated_entity_name);
+    Write(data, (uint8)record.requires_action);
+  } else {
+    Write(data, DataLoader::MeshIndexToId(state, record.mesh_index));
+    Write(data, record.color.rgba);
+    Write(data, record.material.data);
+  }
+}
+
+static LevelRecord ReadLevelRecord(State& state, JournalReader& reader) {
+  LevelRecord record;
+
+  record.is_entity = reader.read<uint8>() != 0;
+  record.position = reader.read_vec3f();
+  record.scale = reader.read_vec3f();
+  record.rotation = reader.read_quaternion();
+
+  if (record.is_entity) {
+    record.entity_type = DataLoader::EntityNameToType(reader.read_string());
+    record.tint = reader.read_vec3f();
+    record.astro_start_time = reader.read<float>();
+    record.astro_end_time = reader.read<float>();
+    record.item_pickup_name = reader.read_string();
+    record.unique_name = reader.read_string();
+    record.associated_entity_name = reader.read_string();
+    record.requires_action = reader.read<uint8>() != 0;
+  } else {
+    uint16 mesh_id = reader.read<uint16>();
+
+    record.color.rgba = reader.read<uint16>();
+    record.material.data = reader.read<uint16>();
+
+    if (!reader.is_truncated) {
+      record.mesh_index = DataLoader::MeshIdToIndex(state, mesh_id);
+    }
+  }
+
+  return record;
+}
+
+/**
+ * ----------------------------
+ * Converts an operation into the operation which reverses it.
+ * ----------------------------
+ */
+static EditOperation GetInverseOperation(const EditOperation& operation) {
+  EditOperation inverse = operation;
+
+  if (operation.type == EDIT_CREATE) inverse.type = EDIT_DELETE;
+  if (operation.type == EDIT_DELETE) inverse.type = EDIT_CREATE;
+
+  inverse.before = operation.after;
+  inverse.after = operation.before;
+
+  return inverse;
+}
+
+/**
+ * ----------------------------
+ * Two records match if they would be written to the level file
+ * identically. Records loaded from the level file have had their
+ * values rounded, so exact comparisons would miss them.
+ * ----------------------------
+ */
+static bool IsSameLevelRecord(const LevelRecord& a, const LevelRecord& b) {
+  if (a.is_entity != b.is_entity) {
+    return false;
+  }
+
+  if (a.is_entity) {
+    return a.entity_type == b.entity_type && SerializeEntity(a) == SerializeEntity(b);
+  } else {
+    return a.mesh_index == b.mesh_index && SerializeObject(a, 0) == SerializeObject(b, 0);
+  }
+}
+
+static GameEntity* FindMatchingEntity(State& state, const LevelRecord& record) {
+  for_entities_of_type(record.entity_type) {
+    auto& entity = entities[i];
+
+    if (IsSameLevelRecord(EditJournal::GetLevelRecord(entity), record)) {
+      return &entity;
+    }
+  }
+
+  return nullptr;
+}
+
+static tObject* FindMatchingObject(Tachyon* tachyon, const LevelRecord& record) {
+  for (auto& object : objects(record.mesh_index)) {
+    if (IsSameLevelRecord(EditJournal::GetLevelRecord(object), record)) {
+      return &object;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * ----------------------------
+ * Applies a journaled operation to the level as it was loaded.
+ * Entities and objects are found by their saved properties, since
+ * their IDs are not stable between runs; any with identical saved
+ * properties are interchangeable.
+ * ----------------------------
+ */
+static void ReplayOperation(Tachyon* tachyon, State& state, const EditOperation& operation) {
+  auto& before = operation.before;
+  auto& after = operation.after;
+
+  if (operation.type == EDIT_CREATE) {
+    if (after.is_entity) {
+      GameEntity entity = EntityManager::CreateNewEntity(state, after.entity_type);
+
+      entity.position = after.position;
+      entity.scale = after.scale;
+      entity.orientation = after.rotation;
+      entity.tint = after.tint;
+      entity.astro_start_time = after.astro_start_time;
+      entity.astro_end_time = after.astro_end_time;
+      entity.item_pickup_name = after.item_pickup_name;
+      entity.unique_name = after.unique_name;
+      entity.associated_entity_name = after.associated_entity_name;
+      entity.requires_action = after.requires_action;
+
+      // @temporary
+      if (entity.type == LAMPPOST && !entity.requires_action) {
+        entity.did_activate = true;
+      }
+
+      // @temporary
+      if (entity.type == SCULPTURE_1 && entity.requires_action) {
+        entity.did_activate = true;
+      }
+
+      entity.visible_position = entity.position;
+      entity.visible_rotation = entity.orientation;
+
+      EntityManager::SaveNewEntity(state, entity);
+
+      for (auto mesh_id : EntityDispatcher::GetMeshes(state, entity.type)) {
+        create(mesh_id);
+      }
+    } else {
+      auto& object = create(after.mesh_index);
+
+      object.position = after.position;
+      object.scale = after.scale;
+      object.rotation = after.rotation;
+      object.color = after.color;
+      object.material = after.material;
+
+      commit(object);
+    }
+
+    return;
+  }
+
+  if (before.is_entity) {
+    GameEntity* entity = FindMatchingEntity(state, before);
+
+    if (entity == nullptr) {
+      console_log("[ReplayLevelJournal] Skipped an operation on a missing " + GetEntityTypeName(before.entity_type));
+
+      return;
+    }
+
+    if (operation.type == EDIT_MODIFY) {
+      entity->position = after.position;
+      entity->scale = after.scale;
+      entity->orientation = after.rotation;
+      entity->tint = after.tint;
+      entity->astro_start_time = after.astro_start_time;
+      entity->astro_end_time = after.astro_end_time;
+      entity->item_pickup_name = after.item_pickup_name;
+      entity->requires_action = after.requires_action;
+
+      entity->visible_position = entity->position;
+      entity->visible_rotation = entity->orientation;
+
+      EntityManager::SetUniqueName(state, *entity, after.unique_name);
+      EntityManager::SetAssociatedEntityName(state, *entity, after.associated_entity_name);
+    } else {
+      EntityRecord record;
+      record.type = entity->type;
+      record.id = entity->id;
+
+      if (entity->light_id > -1) {
+        remove_point_light(entity->light_id);
+      }
+
+      EntityManager::DeleteEntity(state, record);
+
+      // Remove objects associated with the entity
+      for (auto mesh_id : EntityDispatcher::GetMeshes(state, record.type)) {
+        auto& objects = objects(mesh_id);
+
+        if (objects.total_active > 0) {
+          remove_object(objects[objects.total_active - 1]);
+        }
+      }
+    }
+  } else {
+    tObject* object = FindMatchingObject(tachyon, before);
+
+    if (object == nullptr) {
+      console_log("[ReplayLevelJournal] Skipped an operation on a missing object");
+
+      return;
+    }
+
+    if (operation.type == EDIT_MODIFY) {
+      object->position = after.position;
+      object->scale = after.scale;
+      object->rotation = after.rotation;
+      object->color = after.color;
+      object->material = after.material;
+
+      commit(*object);
+    } else {
+      remove_object(*object);
+    }
+  }
+}
+
+/**
+ * ----------------------------
+ * Appends operations to the end of the journal. Each operation
+ * is prefixed with its size, so an operation which was only
+ * partially written can be detected and ignored when replaying.
+ * ----------------------------
+ */
+static void AppendToJournal(State& state, const std::vector<EditOperation>& operations) {
+  std::string data;
+
+  for (auto& operation : operations) {
+    std::string entry;
+
+    Write(entry, next_sequence++);
+    Write(entry, (uint8)operation.type);
+    WriteLevelRecord(state, entry, operation.before);
+    WriteLevelRecord(state, entry, operation.after);
+
+    Write(data, (uint32)entry.size());
+
+    data.append(entry);
+  }
+
+  std::lock_guard<std::mutex> lock(journal_mutex);
+  std::ofstream file(LEVEL_JOURNAL_PATH, std::ios::binary | std::ios::app);
+
+  file.write(data.data(), data.size());
+
+  if (!file) {
+    console_log("Failed to save level data to the journal");
+
+    return;
+  }
+
+  journal_size += (uint32)data.size();
+}
+
+/**
+ * ----------------------------
+ * Writes a level snapshot to the level file, then clears the journal
+ * if nothing has been appended to it since the snapshot was taken.
+ * Runs on a worker thread. A journal which is left alone is replayed
+ * from the first operation after the snapshot.
+ * ----------------------------
+ */
+static void WriteLevelSnapshot(const LevelSnapshot& snapshot) {
+  std::string level_data = "#" + std::to_string(snapshot.sequence) + "\n";
+
+  for (size_t i = 0; i < snapshot.entities.size(); i++) {
+    level_data += "@" + snapshot.entity_type_names[i] + "\n";
+
+    for (auto& record : snapshot.entities[i]) {
+      level_data += SerializeEntity(record) + "\n";
+    }
+  }
+
+  // Delimiter between entities and static decorative mesh objects
+  level_data += "====\n";
+
+  for (size_t i = 0; i < snapshot.objects.size(); i++) {
+    level_data += SerializeObject(snapshot.objects[i], snapshot.object_mesh_ids[i]) + "\n";
+  }
+
+  // Write to a temporary file first, so the level file
+  // is never left half-written
+  Tachyon_WriteFileContents(LEVEL_FILE_PATH ".tmp", level_data);
+
+  std::error_code error;
+
+  std::filesystem::rename(LEVEL_FILE_PATH ".tmp", LEVEL_FILE_PATH, error);
+
+  if (error) {
+    console_log("Failed to save level data: " + error.message());
+
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(journal_mutex);
+
+  if (journal_size == snapshot.journal_size) {
+    std::filesystem::remove(LEVEL_JOURNAL_PATH, error);
+
+    if (!error) {
+      journal_size = 0;
+    }
+  }
+}
+
+/**
+ * ----------------------------
+ * Finds the existing subject matching an edited entity or object,
+ * or starts tracking a new one.
+ * ----------------------------
+ */
+static uint32 FindOrAddSubject(EditLog& log, const EditSubject& subject) {
+  for (uint32 i = 0; i < log.subjects.size(); i++) {
+    auto& existing = log.subjects[i];
+
+    if (
+      existing.exists &&
+      existing.is_entity == subject.is_entity &&
+      existing.entity_record.type == subject.entity_record.type &&
+      existing.entity_record.id == subject.entity_record.id &&
+      existing.mesh_index == subject.mesh_index &&
+      existing.object_id == subject.object_id
+    ) {
+      return i;
+    }
+  }
+
+  log.subjects.push_back(subject);
+
+  return (uint32)log.subjects.size() - 1;
+}
+
+static void RecordEdit(EditLog& log, EditOperationType type, const EditSubject& subject, const LevelRecord& before, const LevelRecord& after) {
+  // Recording a new operation discards anything which was undone
+  log.operations.resize(log.total_applied);
+
+  uint32 subject_index = FindOrAddSubject(log, subject);
+
+  log.subjects[subject_index].exists = type != EDIT_DELETE;
+
+  log.operations.push_back({
+    .type = type,
+    .subject = subject_index,
+    .before = before,
+    .after = after
+  });
+
+  log.total_applied++;
+  log.unsaved_operations.push_back(log.operations.back());
+}
+
+/* ---------------------------- */
+
+LevelRecord EditJournal::GetLevelRecord(const GameEntity& entity) {
+  LevelRecord record;
+
+  record.is_entity = true;
+  record.position = entity.position;
+  record.scale = entity.scale;
+  record.rotation = entity.orientation;
+  record.entity_type = entity.type;
+  record.tint = entity.tint;
+  record.astro_start_time = entity.astro_start_time;
+  record.astro_end_time = entity.astro_end_time;
+  record.item_pickup_name = entity.item_pickup_name;
+  record.unique_name = entity.unique_name;
+  record.associated_entity_name = entity.associated_entity_name;
+  record.requires_action = entity.requires_action;
+
+  return record;
+}
+
+LevelRecord EditJournal::GetLevelRecord(const tObject& object) {
+  LevelRecord record;
+
+  record.is_entity = false;
+  record.position = object.position;
+  record.scale = object.scale;
+  record.rotation = object.rotation;
+  record.mesh_index = object.mesh_index;
+  record.color = object.color;
+  record.material = object.material;
+
+  return record;
+}
+
+bool EditJournal::HasChanged(const LevelRecord& before, const LevelRecord& after) {
+  return !(
+    before.is_entity == after.is_entity &&
+    before.entity_type == after.entity_type &&
+    before.position == after.position &&
+    before.scale == after.scale &&
+    before.rotation == after.rotation &&
+    before.tint == after.tint &&
+    before.astro_start_time == after.astro_start_time &&
+    before.astro_end_time == after.astro_end_time &&
+    before.item_pickup_name == after.item_pickup_name &&
+    before.unique_name == after.unique_name &&
+    before.associated_entity_name == after.associated_entity_name &&
+    before.requires_action == after.requires_action &&
+    before.mesh_index == after.mesh_index &&
+    before.color.rgba == after.color.rgba &&
+    before.material.data == after.material.data
+  );
+}
+
+void EditJournal::RecordEntityEdit(EditLog& log, EditOperationType type, const EntityRecord& entity_record, const LevelRecord& before, const LevelRecord& after) {
+  EditSubject subject;
+  subject.is_entity = true;
+  subject.entity_record = entity_record;
+
+  RecordEdit(log, type, subject, before, after);
+}
+
+void EditJournal::RecordObjectEdit(EditLog& log, EditOperationType type, const tObject& object, const LevelRecord& before, const LevelRecord& after) {
+  EditSubject subject;
+  subject.is_entity = false;
+  subject.mesh_index = object.mesh_index;
+  subject.object_id = object.object_id;
+
+  RecordEdit(log, type, subject, before, after);
+}
+
+const EditOperation* EditJournal::Undo(EditLog& log) {
+  if (log.total_applied == 0) {
+    return nullptr;
+  }
+
+  auto& operation = log.operations[--log.total_applied];
+
+  if (operation.type == EDIT_CREATE) log.subjects[operation.subject].exists = false;
+  if (operation.type == EDIT_DELETE) log.subjects[operation.subject].exists = true;
+
+  log.unsaved_operations.push_back(GetInverseOperation(operation));
+
+  return &operation;
+}
+
+const EditOperation* EditJournal::Redo(EditLog& log) {
+  if (log.total_applied == log.operations.size()) {
+    return nullptr;
+  }
+
+  auto& operation = log.operations[log.total_applied++];
+
+  if (operation.type == EDIT_CREATE) log.subjects[operation.subject].exists = true;
+  if (operation.type == EDIT_DELETE) log.subjects[operation.subject].exists = false;
+
+  log.unsaved_operations.push_back(operation);
+
+  return &operation;
+}
+
+void EditJournal::Reset(EditLog& log) {
+  log.operations.clear();
+  log.subjects.clear();
+  log.total_applied = 0;
+}
+
+/**
+ * ----------------------------
+ * Appends the changes made since the last save to the level journal,
+ * which takes far less time than rewriting the level file. Once the
+ * journal grows large enough, it is compacted into the level file.
+ * ----------------------------
+ */
+void EditJournal::SaveLevelData(Tachyon* tachyon, State& state, EditLog& log) {
+  if (log.unsaved_operations.size() == 0) {
+    return;
+  }
+
+  log_time("SaveLevelData()");
+
+  AppendToJournal(state, log.unsaved_operations);
+
+  log.unsaved_operations.clear();
+
+  bool should_compact;
+
+  {
+    std::lock_guard<std::mutex> lock(journal_mutex);
+
+    should_compact = journal_size > MAX_JOURNAL_SIZE;
+  }
+
+  if (should_compact) {
+    CompactLevelData(tachyon, state);
+  }
+}
+
+/**
+ * ----------------------------
+ * Copies the level on the calling thread, and rewrites the level
+ * file from it on a worker thread, folding in the journal so far.
+ * Skipped if there is nothing in the journal.
+ * ----------------------------
+ */
+void EditJournal::CompactLevelData(Tachyon* tachyon, State& state) {
+  save_worker.join();
+
+  uint32 current_journal_size;
+
+  {
+    std::lock_guard<std::mutex> lock(journal_mutex);
+
+    current_journal_size = journal_size;
+  }
+
+  if (current_journal_size == 0) {
+    return;
+  }
+
+  log_time("CompactLevelData()");
+
+  auto snapshot = CreateLevelSnapshot(tachyon, state);
+
+  snapshot->sequence = next_sequence - 1;
+  snapshot->journal_size = current_journal_size;
+
+  save_worker.thread = std::thread([snapshot]() {
+    WriteLevelSnapshot(*snapshot);
+  });
+}
+
+/**
+ * ----------------------------
+ * Applies any journaled operations which have not yet been compacted
+ * into the level file, i.e. those after the compacted sequence number
+ * written at the top of the level file.
+ * ----------------------------
+ */
+void EditJournal::ReplayLevelJournal(Tachyon* tachyon, State& state, uint32 compacted_sequence) {
+  log_time("ReplayLevelJournal()");
+
+  next_sequence = compacted_sequence + 1;
+
+  if (!std::filesystem::exists(LEVEL_JOURNAL_PATH)) {
+    return;
+  }
+
+  auto journal = Tachyon_GetBinaryFileContents(LEVEL_JOURNAL_PATH);
+  JournalReader reader = { journal };
+
+  while (reader.offset < journal.size()) {
+    uint32 entry_size = reader.read<uint32>();
+
+    if (reader.is_truncated || reader.offset + entry_size > journal.size()) {
+      console_log("[ReplayLevelJournal] Ignored a partially-written operation");
+
+      break;
+    }
+
+    size_t entry_end = reader.offset + entry_size;
+    uint32 sequence = reader.read<uint32>();
+
+    EditOperation operation;
+    operation.type = (EditOperationType)reader.read<uint8>();
+    operation.before = ReadLevelRecord(state, reader);
+    operation.after = ReadLevelRecord(state, reader);
+
+    if (reader.is_truncated || reader.offset != entry_end) {
+      console_log("[ReplayLevelJournal] Ignored a malformed operation");
+
+      break;
+    }
+
+    if (sequence > compacted_sequence) {
+      ReplayOperation(tachyon, state, operation);
+    }
+
+    if (sequence >= next_sequence) {
+      next_sequence = sequence + 1;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(journal_mutex);
+
+  journal_size = (uint32)journal.size();
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "engine/tachyon.h"
+#include "astro/game_state.h"
+
+namespace astro {
+  enum EditOperationType {
+    EDIT_CREATE,
+    EDIT_MODIFY,
+    EDIT_DELETE
+  };
+
+  /**
+   * ----------------------------
+   * The saved properties of an entity or decorative object,
+   * i.e. everything which ends up in the level file.
+   * ----------------------------
+   */
+  struct LevelRecord {
+    bool is_entity = false;
+    tVec3f position;
+    tVec3f scale;
+    Quaternion rotation = Quaternion(1.f, 0, 0, 0);
+
+    // Entities
+    EntityType entity_type = UNSPECIFIED;
+    tVec3f tint;
+    float astro_start_time = 0.f;
+    float astro_end_time = 0.f;
+    std::string item_pickup_name = "";
+    std::string unique_name = "";
+    std::string associated_entity_name = "";
+    bool requires_action = false;
+
+    // Decorative objects
+    uint16 mesh_index = 0;
+    tColor color;
+    tMaterial material = tVec4f(0.6f, 0, 0, 0);
+  };
+
+  /**
+   * ----------------------------
+   * Something which has been edited, tracked across deletion
+   * and re-creation so operations on it can be undone and
+   * redone even after it has been given a new entity or object ID.
+   * ----------------------------
+   */
+  struct EditSubject {
+    bool is_entity = false;
+    bool exists = true;
+    EntityRecord entity_record;
+    uint16 mesh_index = 0;
+    uint16 object_id = 0;
+  };
+
+  struct EditOperation {
+    EditOperationType type;
+    uint32 subject = 0;
+    LevelRecord before;
+    LevelRecord after;
+  };
+
+  /**
+   * ----------------------------
+   * A log of the operations made in the level editor, appended to
+   * as the level is edited. Operations past total_applied have been
+   * undone, and are dropped once a new operation is recorded.
+   * ----------------------------
+   */
+  struct EditLog {
+    std::vector<EditOperation> operations;
+    std::vector<EditSubject> subjects;
+    uint32 total_applied = 0;
+    // Changes made to the level since the last save, in the order
+    // they happened. Undone operations appear here as their inverse.
+    std::vector<EditOperation> unsaved_operations;
+  };
+
+  namespace EditJournal {
+    LevelRecord GetLevelRecord(const GameEntity& entity);
+    LevelRecord GetLevelRecord(const tObject& object);
+    bool HasChanged(const LevelRecord& before, const LevelRecord& after);
+    void RecordEntityEdit(EditLog& log, EditOperationType type, const EntityRecord& entity_record, const LevelRecord& before, const LevelRecord& after);
+    void RecordObjectEdit(EditLog& log, EditOperationType type, const tObject& object, const LevelRecord& before, const LevelRecord& after);
+    const EditOperation* Undo(EditLog& log);
+    const EditOperation* Redo(EditLog& log);
+    void Reset(EditLog& log);
+    void SaveLevelData(Tachyon* tachyon, State& state, EditLog& log);
+    void CompactLevelData(Tachyon* tachyon, State& state);
+    void ReplayLevelJournal(Tachyon* tachyon, State& state, uint32 compacted_sequence);
+  }
+}
\ No newline at end of file
@@ -256,6 +256,9 @@ namespace astro {
     // For entities with associated or dependent behaviors
     std::string unique_name = "";
     std::string associated_entity_name = "";
+    // Interned symbols for the names above; 0 means no name
+    uint32 unique_name_symbol = 0;
+    uint32 associated_entity_symbol = 0;
     // Cached at start time using the associated entity name
     EntityRecord associated_entity_record;
 
@@ -3,6 +3,7 @@
 
 #include "astro/entity_behaviors/behavior.h"
 #include "astro/collision_system.h"
+#include "astro/entity_manager.h"
 
 namespace astro {
   behavior AreaChange {
@@ -30,22 +31,22 @@ namespace astro {
           Location previous_location = state.current_location;
 
           // Match area change entity names to locations
-          if (entity.unique_name == "tutorial") {
+          if (entity.unique_name_symbol == state.name_symbols.tutorial) {
             state.current_location = Location::TUTORIAL;
           }
-          else if (entity.unique_name == "divination_woodrealm") {
+          else if (entity.unique_name_symbol == state.name_symbols.divination_woodrealm) {
             state.current_location = Location::DIVINATION_WOODREALM;
           }
-          else if (entity.unique_name == "riverway") {
+          else if (entity.unique_name_symbol == state.name_symbols.riverway) {
             state.current_location = Location::DIVINATION_RIVERWAY;
           }
-          else if (entity.unique_name == "promenade") {
+          else if (entity.unique_name_symbol == state.name_symbols.promenade) {
             state.current_location = Location::DIVINATION_LAKE_PROMENADE;
           }
-          else if (entity.unique_name == "lakefront_south") {
+          else if (entity.unique_name_symbol == state.name_symbols.lakefront_south) {
             state.current_location = Location::DIVINATION_LAKEFRONT_SOUTH;
           }
-          else if (entity.unique_name == "garden") {
+          else if (entity.unique_name_symbol == state.name_symbols.garden) {
             state.current_location = Location::GARDEN_OF_MONASTICS;
           }
 
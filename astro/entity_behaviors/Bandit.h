@@ -151,6 +151,10 @@ namespace astro {
       // once that list is built
       for_entities(state.bandits) {
         auto& entity = state.bandits[i];
+
+        // Keep targeting up to date with where the enemy moved to
+        Targeting::UpdateTargetableEntity(state, entity);
+
         auto& model = objects(meshes.bandit)[i];
 
         // @todo factor
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "astro/entity_behaviors/behavior.h"
+#include "astro/entity_manager.h"
 #include "astro/game_events.h"
 
 namespace astro {
@@ -28,7 +29,7 @@ namespace astro {
         if (entity.did_activate) continue;
 
         // Do nothing if the trigger is unidentified
-        if (entity.unique_name.empty()) continue;
+        if (entity.unique_name_symbol == 0) continue;
 
         // Do nothing if the trigger is in a different time period
         if (!IsDuringActiveTime(entity, state)) continue;
@@ -36,7 +37,7 @@ namespace astro {
         float player_distance = tVec3f::distance(state.player_position, entity.position);
         float event_radius = 2000.f * (entity.scale.x / 1500.f);
 
-        if (player_distance < event_radius && entity.unique_name != "tutorial_bird") {
+        if (player_distance < event_radius && entity.unique_name_symbol != state.name_symbols.tutorial_bird) {
           entity.did_activate = true;
 
           GameEvents::StartEvent(tachyon, state, entity.unique_name);
@@ -44,7 +45,7 @@ namespace astro {
 
         // @hack @temporary
         if (
-          entity.unique_name == "tutorial_bird" &&
+          entity.unique_name_symbol == state.name_symbols.tutorial_bird &&
           !entity.did_activate &&
           player_distance < 4000.f &&
           state.is_holding_up_wand
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "astro/entity_behaviors/behavior.h"
+#include "astro/targeting.h"
 #include "astro/ui_system.h"
 
 namespace astro {
@@ -59,6 +60,9 @@ namespace astro {
       for_entities(state.faeries) {
         auto& entity = state.faeries[i];
 
+        // Keep targeting up to date with where the enemy moved to
+        Targeting::UpdateTargetableEntity(state, entity);
+
         // @todo check active time, astro turn speed etc.
         if (
           !IsInRangeX(entity, state, 25000.f) ||
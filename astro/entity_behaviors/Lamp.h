@@ -1,6 +1,7 @@
 #pragma once
 
 #include "astro/entity_behaviors/behavior.h"
+#include "astro/entity_manager.h"
 
 namespace astro {
   behavior Lamp {
@@ -57,7 +58,7 @@ namespace astro {
           Sync(frame, entity);
 
           // @temporary
-          if (entity.unique_name == "swing_lamp") {
+          if (entity.unique_name_symbol == state.name_symbols.swing_lamp) {
             frame.rotation *= Quaternion::fromAxisAngle(tVec3f(0, 1.f, 0), 0.3f * sinf(get_scene_time()));
           }
 
@@ -298,6 +298,10 @@ namespace astro {
 
       for_entities(state.lesser_guards) {
         auto& entity = state.lesser_guards[i];
+
+        // Keep targeting up to date with where the enemy moved to
+        Targeting::UpdateTargetableEntity(state, entity);
+
         bool is_active = IsDuringActiveTime(entity, state);
 
         if (!is_active) {
@@ -182,6 +182,10 @@ namespace astro {
 
       for_entities(state.low_guards) {
         auto& entity = state.low_guards[i];
+
+        // Keep targeting up to date with where the enemy moved to
+        Targeting::UpdateTargetableEntity(state, entity);
+
         bool is_active = IsDuringActiveTime(entity, state);
 
         if (!is_active) {
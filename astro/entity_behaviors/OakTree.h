@@ -95,19 +95,17 @@ namespace astro {
           continue;
         }
 
+        float entity_age = state.astro_time - entity.astro_start_time;
+        float subsurface = GetSubsurfaceScattering(entity_age);
+        tVec4f wood_material = tVec4f(1.f, 0, 0, subsurface);
+
         float life_progress = GetLivingEntityProgress(state, entity, lifetime);
         float growth_factor = 0.f;
 
         if (life_progress > 0.f) {
-          float entity_age = state.astro_time - entity.astro_start_time;
-
           growth_factor = sqrtf(1.f - expf(-0.01f * entity_age));
         }
 
-        float entity_age = state.astro_time - entity.astro_start_time;
-        float subsurface = GetSubsurfaceScattering(entity_age);
-        tVec4f wood_material = tVec4f(1.f, 0, 0, subsurface);
-
         float tree_height = 1.f - powf(1.f - growth_factor, 4.f);
         float tree_thickness = -(cosf(t_PI * growth_factor) - 1.f) / 2.f;
 
@@ -153,7 +151,6 @@ namespace astro {
         // Branches
         {
           auto& branches = use_instance(meshes.oak_tree_branches);
-          float branches_size = growth_factor > 0.5f ? 2.f * (growth_factor - 0.5f) : 0.f;
 
           branches.position = entity.position;
           branches.scale = tree_scale;
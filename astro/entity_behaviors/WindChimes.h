@@ -1,6 +1,7 @@
 #pragma once
 
 #include "astro/entity_behaviors/behavior.h"
+#include "astro/entity_manager.h"
 #include "astro/time_evolution.h"
 
 namespace astro {
@@ -19,7 +20,7 @@ namespace astro {
       // @temporary
       // @todo have different wind chimes for different time ranges
       {
-        if (entity.unique_name == "game_start_chimes") {
+        if (entity.unique_name_symbol == state.name_symbols.game_start_chimes) {
           if (state.astro_time == astro_time_periods.future) {
             // Future -> Present
             TimeEvolution::StartAstroTraveling(tachyon, state, astro_time_periods.present);
@@ -35,7 +36,7 @@ namespace astro {
       // @temporary
       // @todo have different wind chimes for different time ranges
       {
-        if (entity.unique_name == "distant_past") {
+        if (entity.unique_name_symbol == state.name_symbols.distant_past) {
           if (state.astro_time == astro_time_periods.past) {
             // Past -> Distant past
             TimeEvolution::StartAstroTraveling(tachyon, state, astro_time_periods.distant_past);
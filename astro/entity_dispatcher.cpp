@@ -295,4 +295,89 @@ void EntityDispatcher::TimeEvolve(Tachyon* tachyon, State& state, EntityType typ
       exit(0);
       break;
   }
+}
+
+/**
+ * Entity types whose time evolution only reads the inputs in
+ * EntityEvolutionInputs, and only writes to their own entities
+ * and mesh groups. No sounds, lights, random numbers, object
+ * creation or writes to shared state, so they can be evolved
+ * concurrently with one another.
+ */
+bool EntityDispatcher::CanTimeEvolveInParallel(EntityType type) {
+  switch (type) {
+    case BIRCH_TREE:
+    case CASTLE_ARCH:
+    case CASTLE_RAMPART:
+    case CASTLE_STEEPLE:
+    case CASTLE_TOWER:
+    case CASTLE_WALL_FOUNTAIN:
+    case CHESTNUT_TREE:
+    case DIRT_PATH_NODE:
+    case FLAG:
+    case FLOWER_BUSH:
+    case GROUND_FLOWER_PATCH:
+    case HEAVY_SWITCH:
+    case HOSTA_BUSH:
+    case LADDER:
+    case LEAF_SHRUB:
+    case LILAC_BUSH:
+    case LILY_PAD_CLUSTER:
+    case OAK_TREE:
+    case RIVER_LOG:
+    case ROSE_BUSH:
+    case SHRUB:
+    case SMALL_STONE_BRIDGE:
+    case STONE_WALL:
+    case SUNBEAM:
+    case TALL_BIRCH:
+    case TALL_EVERGREEN_SHRUB:
+    case TALL_GRASS:
+    case TALL_WEEDS:
+    case TULIP_PLANT:
+    case VINE:
+    case WILLOW_TREE:
+    case WOODEN_BRIDGE:
+    case WOODEN_FENCE:
+    case WOODEN_GATE_DOOR:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * Parallel entity types whose time evolution depends on nothing
+ * besides their entities and EntityEvolutionInputs, so they can
+ * be skipped while those inputs stay the same.
+ */
+bool EntityDispatcher::IsTimeEvolutionStatic(EntityType type) {
+  switch (type) {
+    // Animated over running time
+    case RIVER_LOG:
+    // Rotated toward the scene's light direction
+    case SUNBEAM:
+      return false;
+
+    default:
+      return CanTimeEvolveInParallel(type);
+  }
+}
+
+/**
+ * Entity types whose time evolution writes to EntityEvolutionInputs,
+ * so parallel types ordered before them must finish evolving first.
+ */
+bool EntityDispatcher::ChangesTimeEvolutionInputs(EntityType type) {
+  switch (type) {
+    // Changes the current location
+    case AREA_CHANGE:
+    // Toggles the vantage camera
+    case VANTAGE_SPOT:
+      return true;
+
+    default:
+      return false;
+  }
 }
\ No newline at end of file
@@ -10,5 +10,8 @@ namespace astro {
     const std::vector<uint16>& GetMeshes(State& state, EntityType type);
     uint16 GetPlaceholderMesh(State& state, EntityType type);
     void TimeEvolve(Tachyon* tachyon, State& state, EntityType type);
+    bool CanTimeEvolveInParallel(EntityType type);
+    bool IsTimeEvolutionStatic(EntityType type);
+    bool ChangesTimeEvolutionInputs(EntityType type);
   }
 }
\ No newline at end of file
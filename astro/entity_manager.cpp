@@ -1,30 +1,64 @@
 #include "astro/entity_manager.h"
 #include "astro/entity_dispatcher.h"
+#include "astro/targeting.h"
 
 using namespace astro;
 
 static int32 running_entity_id = 0;
 
-static inline GameEntity* FindEntityByRecord(std::vector<GameEntity>& entities, const EntityRecord& record) {
-  for (auto& entity : entities) {
-    if (entity.id == record.id) {
-      return &entity;
-    }
+static inline void SetEntityIndex(State& state, const int32 entity_id, const int32 index) {
+  auto& entity_index_by_id = state.entity_index_by_id;
+
+  if (entity_id >= (int32)entity_index_by_id.size()) {
+    entity_index_by_id.resize(entity_id + 1, -1);
   }
 
-  return nullptr;
+  entity_index_by_id[entity_id] = index;
 }
 
-static inline void DeleteEntityByRecord(std::vector<GameEntity>& entities, const EntityRecord& record) {
-  // @todo @optimize If we wanted, we could swap with the last element
-  // and declare a bound on the number of "active" entities, instead of
-  // removing them from the array and shuffling data around memory.
-  // However, this will suffice for now.
-  for (size_t i = 0; i < entities.size(); i++) {
-    if (record.id == entities[i].id) {
-      entities.erase(entities.begin() + i);
+static inline int32 GetEntityIndex(State& state, const EntityRecord& record) {
+  auto& entity_index_by_id = state.entity_index_by_id;
+
+  if (record.id < 0 || record.id >= (int32)entity_index_by_id.size()) {
+    return -1;
+  }
+
+  return entity_index_by_id[record.id];
+}
+
+static void RegisterNamedEntity(State& state, const GameEntity& entity) {
+  if (entity.unique_name_symbol == 0) {
+    return;
+  }
+
+  auto& records = state.entity_records_by_name_symbol;
 
-      break;
+  // Where names are shared, the first entity registered keeps the name
+  if (records.find(entity.unique_name_symbol) == records.end()) {
+    records[entity.unique_name_symbol] = { entity.type, entity.id };
+  }
+}
+
+static void UnregisterNamedEntity(State& state, const uint32 name_symbol, const int32 entity_id) {
+  auto& records = state.entity_records_by_name_symbol;
+  auto entry = records.find(name_symbol);
+
+  if (entry == records.end() || entry->second.id != entity_id) {
+    return;
+  }
+
+  records.erase(entry);
+
+  // Hand the name over to any other entity sharing it
+  for_all_entity_types() {
+    for_entities_of_type(type) {
+      auto& other = entities[i];
+
+      if (other.id != entity_id && other.unique_name_symbol == name_symbol) {
+        records[other.unique_name_symbol] = { other.type, other.id };
+
+        return;
+      }
     }
   }
 }
@@ -41,32 +75,144 @@ void EntityManager::SaveNewEntity(State& state, const GameEntity& entity) {
   auto& container = EntityDispatcher::GetEntityContainer(state, entity.type);
 
   container.push_back(entity);
+
+  // Make sure the new entity's type gets time-evolved
+  state.entity_evolution_inputs.clear();
+
+  auto& saved_entity = container.back();
+
+  saved_entity.unique_name_symbol = GetNameSymbol(state, entity.unique_name);
+  saved_entity.associated_entity_symbol = GetNameSymbol(state, entity.associated_entity_name);
+
+  SetEntityIndex(state, entity.id, (int32)container.size() - 1);
+  RegisterNamedEntity(state, saved_entity);
+  Targeting::UpdateTargetableEntity(state, saved_entity);
 }
 
 GameEntity* EntityManager::FindEntity(State& state, const EntityRecord& record) {
+  int32 index = GetEntityIndex(state, record);
+
+  if (index == -1) {
+    return nullptr;
+  }
+
   auto& entities = EntityDispatcher::GetEntityContainer(state, record.type);
 
-  return FindEntityByRecord(entities, record);
+  // Verify the entity still matches the record, in case
+  // the record's type does not correspond to its id
+  if (index >= (int32)entities.size() || entities[index].id != record.id) {
+    return nullptr;
+  }
+
+  return &entities[index];
 }
 
 GameEntity* EntityManager::FindEntityByUniqueName(State& state, const std::string& unique_name) {
-  for_all_entity_types() {
-    for_entities_of_type(type) {
-      auto& entity = entities[i];
+  auto symbol = state.entity_name_symbols.find(unique_name);
 
-      if (entity.unique_name == unique_name) {
-        return &entity;
-      }
-    }
+  if (symbol == state.entity_name_symbols.end()) {
+    return nullptr;
   }
 
-  return nullptr;
+  return FindEntityByNameSymbol(state, symbol->second);
+}
+
+GameEntity* EntityManager::FindEntityByNameSymbol(State& state, const uint32 name_symbol) {
+  auto& records = state.entity_records_by_name_symbol;
+  auto entry = records.find(name_symbol);
+
+  if (entry == records.end()) {
+    return nullptr;
+  }
+
+  return FindEntity(state, entry->second);
+}
+
+uint32 EntityManager::GetNameSymbol(State& state, const std::string& name) {
+  if (name.empty()) {
+    return 0;
+  }
+
+  auto& symbols = state.entity_name_symbols;
+  auto symbol = symbols.find(name);
+
+  if (symbol != symbols.end()) {
+    return symbol->second;
+  }
+
+  uint32 new_symbol = (uint32)symbols.size() + 1;
+
+  symbols.emplace(name, new_symbol);
+
+  return new_symbol;
+}
+
+/**
+ * Interns the entity names game code checks against, so those
+ * checks only ever compare symbols.
+ */
+void EntityManager::InternNameSymbols(State& state) {
+  auto& symbols = state.name_symbols;
+
+  symbols.tutorial = GetNameSymbol(state, "tutorial");
+  symbols.divination_woodrealm = GetNameSymbol(state, "divination_woodrealm");
+  symbols.riverway = GetNameSymbol(state, "riverway");
+  symbols.promenade = GetNameSymbol(state, "promenade");
+  symbols.lakefront_south = GetNameSymbol(state, "lakefront_south");
+  symbols.garden = GetNameSymbol(state, "garden");
+  symbols.swing_lamp = GetNameSymbol(state, "swing_lamp");
+  symbols.game_start_chimes = GetNameSymbol(state, "game_start_chimes");
+  symbols.distant_past = GetNameSymbol(state, "distant_past");
+  symbols.tutorial_bird = GetNameSymbol(state, "tutorial_bird");
+  symbols.lake_girl = GetNameSymbol(state, "lake_girl");
+  symbols.gate_guard = GetNameSymbol(state, "gate_guard");
+  symbols.gate_villager = GetNameSymbol(state, "gate_villager");
+  symbols.dweller_river = GetNameSymbol(state, "dweller_river");
+}
+
+void EntityManager::SetUniqueName(State& state, GameEntity& entity, const std::string& unique_name) {
+  UnregisterNamedEntity(state, entity.unique_name_symbol, entity.id);
+
+  entity.unique_name = unique_name;
+  entity.unique_name_symbol = GetNameSymbol(state, unique_name);
+
+  RegisterNamedEntity(state, entity);
+}
+
+void EntityManager::SetAssociatedEntityName(State& state, GameEntity& entity, const std::string& associated_entity_name) {
+  entity.associated_entity_name = associated_entity_name;
+  entity.associated_entity_symbol = GetNameSymbol(state, associated_entity_name);
 }
 
 void EntityManager::DeleteEntity(State& state, const EntityRecord& record) {
+  GameEntity* entity = EntityManager::FindEntity(state, record);
+
+  if (entity == nullptr) {
+    return;
+  }
+
   auto& entities = EntityDispatcher::GetEntityContainer(state, record.type);
+  int32 index = state.entity_index_by_id[record.id];
+  int32 last_index = (int32)entities.size() - 1;
+  uint32 unique_name_symbol = entity->unique_name_symbol;
+
+  // Swap the last entity into the deleted entity's place,
+  // so entity containers remain densely packed
+  if (index != last_index) {
+    entities[index] = std::move(entities[last_index]);
+
+    SetEntityIndex(state, entities[index].id, index);
+  }
+
+  entities.pop_back();
+
+  SetEntityIndex(state, record.id, -1);
+
+  UnregisterNamedEntity(state, unique_name_symbol, record.id);
+  Targeting::RemoveTargetableEntity(state, record);
 
-  DeleteEntityByRecord(entities, record);
+  // Make sure the deleted entity's type gets time-evolved
+  state.entity_evolution_inputs.clear();
 }
 
 void EntityManager::CreateEntityAssociations(State& state) {
@@ -74,9 +220,9 @@ void EntityManager::CreateEntityAssociations(State& state) {
     for_entities_of_type(type) {
       auto& entity = entities[i];
 
-      if (entity.associated_entity_name != "") {
+      if (entity.associated_entity_symbol != 0) {
         // @todo warn/cancel if the associated entity is the same as the entity?
-        GameEntity* associated_entity = EntityManager::FindEntityByUniqueName(state, entity.associated_entity_name);
+        GameEntity* associated_entity = EntityManager::FindEntityByNameSymbol(state, entity.associated_entity_symbol);
 
         if (associated_entity != nullptr) {
           entity.associated_entity_record.type = associated_entity->type;
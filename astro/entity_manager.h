@@ -11,6 +11,11 @@ namespace astro {
     void SaveNewEntity(State& state, const GameEntity& entity);
     GameEntity* FindEntity(State& state, const EntityRecord& record);
     GameEntity* FindEntityByUniqueName(State& state, const std::string& unique_name);
+    GameEntity* FindEntityByNameSymbol(State& state, const uint32 name_symbol);
+    uint32 GetNameSymbol(State& state, const std::string& name);
+    void InternNameSymbols(State& state);
+    void SetUniqueName(State& state, GameEntity& entity, const std::string& unique_name);
+    void SetAssociatedEntityName(State& state, GameEntity& entity, const std::string& associated_entity_name);
     void DeleteEntity(State& state, const EntityRecord& record);
     void CreateEntityAssociations(State& state);
   }
@@ -0,0 +1,22 @@
+#include <limits>
+
+#include "astro/evaluation_cache.h"
+
+using namespace astro;
+
+bool EvaluationCache::IsCurrent(const AstroTimeCache& cache, const uint32 key, const float time) {
+  return key < cache.times.size() && cache.times[key] == time;
+}
+
+void EvaluationCache::Store(AstroTimeCache& cache, const uint32 key, const float time) {
+  if (key >= cache.times.size()) {
+    // NaN never compares equal, so new keys are never current
+    cache.times.resize(key + 1, std::numeric_limits<float>::quiet_NaN());
+  }
+
+  cache.times[key] = time;
+}
+
+void EvaluationCache::Reset(AstroTimeCache& cache) {
+  cache.times.clear();
+}
\ No newline at end of file
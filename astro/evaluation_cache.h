@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "engine/tachyon_aliases.h"
+
+namespace astro {
+  /**
+   * ----------------------------
+   * Remembers the time each keyed item (e.g. an object id) was last
+   * evaluated at, so appearance which only depends on astro time
+   * can be reused for as long as that time stays the same.
+   * ----------------------------
+   */
+  struct AstroTimeCache {
+    std::vector<float> times;
+  };
+
+  namespace EvaluationCache {
+    bool IsCurrent(const AstroTimeCache& cache, const uint32 key, const float time);
+    void Store(AstroTimeCache& cache, const uint32 key, const float time);
+    void Reset(AstroTimeCache& cache);
+  }
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "astro/game.h"
 #include "astro/animated_entities.h"
+#include "astro/animation_cache.h"
 #include "astro/astrolabe.h"
 #include "astro/bgm.h"
 #include "astro/camera_system.h"
@@ -74,6 +75,12 @@ static void CreateConstantObjects(Tachyon* tachyon, State& state) {
 
   // Dynamic fauna meshes
   {
+    for_range(1, 10) {
+      // Butterflies
+      create(meshes.butterfly_left_wing);
+      create(meshes.butterfly_right_wing);
+    }
+
     for_range(1, 50) {
       // Tiny birds
       create(meshes.tiny_bird_head);
@@ -191,21 +198,47 @@ static void UpdateLevelsOfDetail(Tachyon* tachyon, State& state) {
 
   // @temporary @todo @optimize improve culling behavior
   static int frame = 0;
+  static tSystemGraph graph;
 
   frame++;
 
-  // Decorative objects
-  if (frame == 0 || frame % 3 == 0) {
-    Tachyon_UseLodByDistance(tachyon, meshes.rock_1, 50000.f, 100000.f);
-    Tachyon_UseLodByDistance(tachyon, meshes.rock_2, 50000.f);
-    Tachyon_UseLodByDistance(tachyon, meshes.river_edge, 50000.f, 100000.f);
-    Tachyon_UseLodByDistance(tachyon, meshes.ground_1, 50000.f, 100000.f);
-    Tachyon_UseLodByDistance(tachyon, meshes.lookout_tower, 60000.f);
+  // Each mesh's objects are partitioned independently of the others,
+  // so every mesh gets its own system and they all run in parallel
+  if (graph.systems.size() == 0) {
+    auto add_lod_system = [&](const char* name, uint16 mesh_index, int frame_phase, float distance, float distance2) {
+      tSystem system;
+      system.name = name;
+      system.reads = { &tachyon->scene.camera };
+      system.writes = { &objects(mesh_index) };
+
+      system.run = [=]() {
+        if (frame % 3 != frame_phase) return;
+
+        if (distance2 > 0.f) {
+          Tachyon_UseLodByDistance(tachyon, mesh_index, distance, distance2);
+        } else {
+          Tachyon_UseLodByDistance(tachyon, mesh_index, distance);
+        }
+      };
+
+      Tachyon_AddSystem(graph, system);
+    };
+
+    // Decorative objects
+    add_lod_system("LoD: rock_1", meshes.rock_1, 0, 50000.f, 100000.f);
+    add_lod_system("LoD: rock_2", meshes.rock_2, 0, 50000.f, 0.f);
+    add_lod_system("LoD: river_edge", meshes.river_edge, 0, 50000.f, 100000.f);
+    add_lod_system("LoD: ground_1", meshes.ground_1, 0, 50000.f, 100000.f);
+    add_lod_system("LoD: lookout_tower", meshes.lookout_tower, 0, 60000.f, 0.f);
+
+    // Procedural objects
+    add_lod_system("LoD: ground_flower", meshes.ground_flower, 1, 35000.f, 0.f);
+    add_lod_system("LoD: tiny_ground_flower", meshes.tiny_ground_flower, 2, 35000.f, 0.f);
+
+    Tachyon_BuildSystemGraph(graph);
   }
 
-  // Procedural objects
-  if (frame == 0 || frame % 3 == 1) Tachyon_UseLodByDistance(tachyon, meshes.ground_flower, 35000.f);
-  if (frame == 0 || frame % 3 == 2) Tachyon_UseLodByDistance(tachyon, meshes.tiny_ground_flower, 35000.f);
+  Tachyon_RunSystemGraph(graph);
 }
 
 static void ShowHighestLevelsOfDetail(Tachyon* tachyon, State& state) {
@@ -801,7 +834,7 @@ static tVec3f GetLastUsedWindChimesPosition(State& state) {
   }
 
   for (auto& entity : state.wind_chimes) {
-    if (entity.unique_name == "game_start_chimes") {
+    if (entity.unique_name_symbol == state.name_symbols.game_start_chimes) {
       return entity.position;
     }
   }
@@ -955,268 +988,268 @@ void astro::InitGame(Tachyon* tachyon, State& state) {
 
   // @todo factor
   {
-    state.animations.player_idle.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_idle/idle_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle/idle_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_idle, {
+      "./astro/3d_skeleton_animations/player_idle/idle_1.gltf",
+      "./astro/3d_skeleton_animations/player_idle/idle_2.gltf"
+    });
 
     state.animations.player_idle.name = "PLAYER_IDLE";
 
-    state.animations.player_idle_quickturn.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_7.gltf").skeleton,
-    };
+    AnimationCache::LoadAnimation(state.animations.player_idle_quickturn, {
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_1.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_2.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_3.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_4.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_5.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_6.gltf",
+      "./astro/3d_skeleton_animations/player_idle_quickturn/idle_quickturn_7.gltf"
+    });
 
     state.animations.player_idle_quickturn.name = "PLAYER_IDLE_QUICKTURN";
 
-    state.animations.player_idle_2.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_2/idle_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_2/idle_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_idle_2, {
+      "./astro/3d_skeleton_animations/player_idle_2/idle_1.gltf",
+      "./astro/3d_skeleton_animations/player_idle_2/idle_2.gltf"
+    });
 
     state.animations.player_idle_2.name = "PLAYER_IDLE_2";
 
-    state.animations.player_idle_wand.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_wand/idle_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_idle_wand/idle_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_idle_wand, {
+      "./astro/3d_skeleton_animations/player_idle_wand/idle_1.gltf",
+      "./astro/3d_skeleton_animations/player_idle_wand/idle_2.gltf"
+    });
 
     state.animations.player_idle_wand.name = "PLAYER_IDLE_WAND";
 
-    state.animations.player_walk.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk/walk_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_walk, {
+      "./astro/3d_skeleton_animations/player_walk/walk_1.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_2.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_3.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_4.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_5.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_6.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_7.gltf",
+      "./astro/3d_skeleton_animations/player_walk/walk_8.gltf"
+    });
 
     state.animations.player_walk.name = "PLAYER_WALK";
 
-    state.animations.player_walk_wand.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_walk_wand/walk_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_walk_wand, {
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_1.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_2.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_3.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_4.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_5.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_6.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_7.gltf",
+      "./astro/3d_skeleton_animations/player_walk_wand/walk_8.gltf"
+    });
 
     state.animations.player_walk_wand.name = "PLAYER_WALK_WAND";
 
-    state.animations.player_run.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run/run_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_run, {
+      "./astro/3d_skeleton_animations/player_run/run_1.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_2.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_3.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_4.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_5.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_6.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_7.gltf",
+      "./astro/3d_skeleton_animations/player_run/run_8.gltf"
+    });
 
     state.animations.player_run.name = "PLAYER_RUN";
 
-    state.animations.player_run_wand.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_run_wand/run_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_run_wand, {
+      "./astro/3d_skeleton_animations/player_run_wand/run_1.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_2.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_3.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_4.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_5.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_6.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_7.gltf",
+      "./astro/3d_skeleton_animations/player_run_wand/run_8.gltf"
+    });
 
     state.animations.player_run_wand.name = "PLAYER_RUN_WAND";
 
-    state.animations.player_climb.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb/climb_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_climb, {
+      "./astro/3d_skeleton_animations/player_climb/climb_1.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_2.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_3.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_4.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_5.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_6.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_7.gltf",
+      "./astro/3d_skeleton_animations/player_climb/climb_8.gltf"
+    });
 
     state.animations.player_climb.name = "PLAYER_CLIMB";
 
-    state.animations.player_climb_up.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_8.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_9.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_10.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_11.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_12.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_13.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_14.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up/climb_up_15.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_climb_up, {
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_1.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_2.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_3.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_4.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_5.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_6.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_7.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_8.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_9.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_10.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_11.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_12.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_13.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_14.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up/climb_up_15.gltf"
+    });
 
     state.animations.player_climb_up.looping = false;
     state.animations.player_climb_up.use_root_motion = true;
     state.animations.player_climb_up.name = "PLAYER_CLIMB_UP";
 
-    state.animations.player_climb_up_jump.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_8.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_9.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_10.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_11.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_climb_up_jump, {
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_1.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_2.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_3.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_4.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_5.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_6.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_7.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_8.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_9.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_10.gltf",
+      "./astro/3d_skeleton_animations/player_climb_up_jump/climb_up_jump_11.gltf"
+    });
 
     state.animations.player_climb_up_jump.looping = false;
     state.animations.player_climb_up_jump.use_root_motion = true;
     state.animations.player_climb_up_jump.name = "PLAYER_CLIMB_UP_JUMP";
 
-    state.animations.player_climb_down_onto.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_8.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_9.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_10.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_11.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_climb_down_onto, {
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_1.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_2.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_3.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_4.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_5.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_6.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_7.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_8.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_9.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_10.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down_onto/climb_down_onto_11.gltf"
+    });
 
     state.animations.player_climb_down_onto.looping = false;
     state.animations.player_climb_down_onto.name = "PLAYER_CLIMB_DOWN_ONTO";
 
-    state.animations.player_climb_down_off.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_climb_down/climb_down_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_climb_down_off, {
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_1.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_2.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_3.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_4.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_5.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_6.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_7.gltf",
+      "./astro/3d_skeleton_animations/player_climb_down/climb_down_8.gltf"
+    });
 
     state.animations.player_climb_down_off.looping = false;
     state.animations.player_climb_down_off.name = "PLAYER_CLIMB_DOWN_OFF";
 
-    state.animations.player_small_hop.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_small_hop/small_hop_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_small_hop, {
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_1.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_2.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_3.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_4.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_5.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_6.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_7.gltf",
+      "./astro/3d_skeleton_animations/player_small_hop/small_hop_8.gltf"
+    });
 
     state.animations.player_small_hop.looping = false;
     state.animations.player_small_hop.name = "PLAYER_SMALL_HOP";
 
-    state.animations.player_swing_wand.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_8.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_swing_wand/swing_9.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_swing_wand, {
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_1.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_2.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_3.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_4.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_5.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_6.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_7.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_8.gltf",
+      "./astro/3d_skeleton_animations/player_swing_wand/swing_9.gltf"
+    });
 
     state.animations.player_swing_wand.name = "PLAYER_SWING_WAND";
 
-    state.animations.player_freefall.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall/freefall_8.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_freefall, {
+      "./astro/3d_skeleton_animations/player_freefall/freefall_1.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_2.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_3.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_4.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_5.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_6.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_7.gltf",
+      "./astro/3d_skeleton_animations/player_freefall/freefall_8.gltf"
+    });
 
     state.animations.player_freefall.name = "PLAYER_FREEFALL";
 
-    state.animations.player_freefall2.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall2/freefall_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_freefall2/freefall_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_freefall2, {
+      "./astro/3d_skeleton_animations/player_freefall2/freefall_1.gltf",
+      "./astro/3d_skeleton_animations/player_freefall2/freefall_2.gltf"
+    });
 
     state.animations.player_freefall2.name = "PLAYER_FREEFALL_2";
 
-    state.animations.player_quick_slowdown.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/player_quick_slowdown/quick_slowdown_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/player_quick_slowdown/quick_slowdown_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.player_quick_slowdown, {
+      "./astro/3d_skeleton_animations/player_quick_slowdown/quick_slowdown_1.gltf",
+      "./astro/3d_skeleton_animations/player_quick_slowdown/quick_slowdown_2.gltf"
+    });
 
     state.animations.player_quick_slowdown.name = "PLAYER_QUICK_SLOWDOWN";
 
     // @todo factor
-    for (auto& bone : state.animations.player_idle.frames[0].bones) {
+    for (auto& bone : state.animations.player_idle.reference_pose.bones) {
       state.player.rig.active_pose.bones.push_back(bone);
     }
   }
 
   // @todo factor
   {
-    state.animations.person_idle.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/person_idle/idle_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_idle/idle_2.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.person_idle, {
+      "./astro/3d_skeleton_animations/person_idle/idle_1.gltf",
+      "./astro/3d_skeleton_animations/person_idle/idle_2.gltf"
+    });
 
-    state.animations.person_talking.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_6.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_7.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_talking/talk_8.gltf").skeleton,
-    };
+    AnimationCache::LoadAnimation(state.animations.person_talking, {
+      "./astro/3d_skeleton_animations/person_talking/talk_1.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_2.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_3.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_4.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_5.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_6.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_7.gltf",
+      "./astro/3d_skeleton_animations/person_talking/talk_8.gltf"
+    });
 
-    state.animations.person_hit_front.frames = {
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_1.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_2.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_3.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_4.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_5.gltf").skeleton,
-      GltfLoader("./astro/3d_skeleton_animations/person_hit_front/hit_6.gltf").skeleton
-    };
+    AnimationCache::LoadAnimation(state.animations.person_hit_front, {
+      "./astro/3d_skeleton_animations/person_hit_front/hit_1.gltf",
+      "./astro/3d_skeleton_animations/person_hit_front/hit_2.gltf",
+      "./astro/3d_skeleton_animations/person_hit_front/hit_3.gltf",
+      "./astro/3d_skeleton_animations/person_hit_front/hit_4.gltf",
+      "./astro/3d_skeleton_animations/person_hit_front/hit_5.gltf",
+      "./astro/3d_skeleton_animations/person_hit_front/hit_6.gltf"
+    });
 
     for_range(0, MAX_ANIMATED_PEOPLE - 1) {
       auto& person = state.skinned_people[i];
 
       // @todo factor
-      for (auto& bone : state.animations.person_idle.frames[0].bones) {
+      for (auto& bone : state.animations.person_idle.reference_pose.bones) {
         person.rig.active_pose.bones.push_back(bone);
       }
     }
@@ -1243,6 +1276,7 @@ void astro::InitGame(Tachyon* tachyon, State& state) {
 
   CreateConstantObjects(tachyon, state);
 
+  EntityManager::InternNameSymbols(state);
   DataLoader::LoadLevelData(tachyon, state);
   DataLoader::LoadNpcDialogue(tachyon, state);
   DataLoader::LoadCameraData(tachyon, state);
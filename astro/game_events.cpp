@@ -50,7 +50,7 @@ static void QueueCameraTargetEvent(Tachyon* tachyon, State& state, GameEntity& t
  */
 static void StartVillageGateGuardEvent(Tachyon* tachyon, State& state) {
   for (auto& entity : state.low_guards) {
-    if (entity.unique_name == "gate_guard") {
+    if (entity.unique_name_symbol == state.name_symbols.gate_guard) {
       QueueCameraTargetEvent(tachyon, state, entity, {
         .delay = 0.65f,
         .duration = 2.f,
@@ -67,7 +67,7 @@ static void StartVillageGateGuardEvent(Tachyon* tachyon, State& state) {
  */
 static void StartVillageGateOpenEvent(Tachyon* tachyon, State& state) {
   for (auto& entity : state.npcs) {
-    if (entity.unique_name == "gate_villager") {
+    if (entity.unique_name_symbol == state.name_symbols.gate_villager) {
       if (!IsDuringActiveTime(entity, state)) {
         // If we open the gate during a time when the gate villager
         // is not present, stop here and do nothing
@@ -91,7 +91,7 @@ static void StartVillageGateOpenEvent(Tachyon* tachyon, State& state) {
  */
 static void StartRiverWheelEvent(Tachyon* tachyon, State& state) {
   for (auto& entity : state.npcs) {
-    if (entity.unique_name == "dweller_river") {
+    if (entity.unique_name_symbol == state.name_symbols.dweller_river) {
       // @TEMPORARY!!!!
       tVec3f move_target_position = tVec3f(-50000.f, 0, 225000.f);
 
@@ -5,8 +5,11 @@
 #include <vector>
 
 #include "engine/tachyon_aliases.h"
+#include "engine/tachyon_particles.h"
+#include "engine/tachyon_spatial_grid.h"
 #include "engine/tachyon_types.h"
 #include "astro/entities.h"
+#include "astro/evaluation_cache.h"
 
 #define MAX_ANIMATED_PEOPLE 10
 
@@ -62,6 +65,7 @@ namespace astro {
       river_leaf,
       dust_mote,
       dust_cloud,
+      flower_particle,
 
       // Dynamic fauna meshes
       butterfly_left_wing,
@@ -267,13 +271,17 @@ namespace astro {
     tColor color;
     int32 dirt_path_segment_index = -1;
     int32 stone_path_segment_index = -1;
-    uint16 active_object_id = 0xFFFF;
   };
 
   struct GrassChunk {
     tVec3f center_position;
     std::vector<GrassBlade> grass_blades;
-    bool is_currently_in_view = false;
+    // Vertical extent of the chunk's blades, for visibility tests
+    float min_y = 0.f;
+    float max_y = 0.f;
+    // The range of small grass instances the chunk is written into
+    // while visible, or -1 when it isn't resident
+    int32 instance_slot = -1;
   };
 
   /**
@@ -322,23 +330,6 @@ namespace astro {
     int32 light_id = -1;
   };
 
-  enum FlowerParticleType {
-    PARTICLE_RISING,
-    PARTICLE_FLOATING,
-    PARTICLE_FADING_OUT
-  };
-
-  struct FlowerParticle {
-    float spawn_time = 0.f;
-    float lifetime = 1.f;
-    float radius = 500.f;
-    tVec3f spawn_position;
-    tVec3f color = tVec3f(1.f);
-    int32 light_id = -1;
-    int32 spawning_entity_id = -1;
-    FlowerParticleType type = PARTICLE_RISING;
-  };
-
   struct DustCloud {
     tVec3f spawn_position;
     float spawn_time;
@@ -386,19 +377,25 @@ namespace astro {
    * Dynamic fauna
    * ----------------------------
    */
-  struct Butterfly {
-    tVec3f position;
-    tVec3f direction;
-    uint16 left_wing;
-    uint16 right_wing;
+  enum ButterflyState {
+    BUTTERFLY_FLYING_STRAIGHT,
+    BUTTERFLY_TURNING_LEFT,
+    BUTTERFLY_TURNING_RIGHT
+  };
 
-    enum State {
-      FLYING_STRAIGHT,
-      TURNING_LEFT,
-      TURNING_RIGHT
-    } state;
+  /**
+   * Butterflies are stored as parallel arrays, so large swarms
+   * can be updated in tight loops and removed by swapping with
+   * the last butterfly.
+   */
+  struct ButterflySwarm {
+    std::vector<tVec3f> positions;
+    std::vector<tVec3f> directions;
+    std::vector<ButterflyState> states;
+    std::vector<float> last_state_change_times;
 
-    float last_state_change_time = 0.f;
+    // For neighbor queries between butterflies
+    tSpatialGrid grid;
   };
 
   struct TinyBird {
@@ -461,9 +458,44 @@ namespace astro {
    * @todo move to engine
    * ----------------------------
    */
+  /**
+   * A rotation quantized using the 'smallest three' method:
+   * the largest component is dropped and reconstructed from
+   * the other three, each of which is stored in 15 bits. The
+   * dropped component index is packed into the top bits of
+   * a and b.
+   */
+  struct tQuantizedRotation {
+    uint16 a = 0;
+    uint16 b = 0;
+    uint16 c = 0;
+  };
+
+  /**
+   * Keyframes for a single bone's rotation or translation.
+   * Tracks with 1 key are constant throughout the animation.
+   * Rotation tracks are curve-fitted, so their keys may be
+   * sparse; key_frames stores the frame each key belongs to.
+   */
+  struct tAnimationTrack {
+    uint16 key_offset = 0;
+    uint16 total_keys = 0;
+  };
+
+  struct tCompressedAnimation {
+    std::vector<tAnimationTrack> rotation_tracks;
+    std::vector<tAnimationTrack> translation_tracks;
+    std::vector<tQuantizedRotation> rotation_keys;
+    std::vector<uint16> rotation_key_frames;
+    std::vector<tVec3f> translation_keys;
+  };
+
   struct tSkeletonAnimation {
-    std::vector<tSkeleton> frames;
-    tSkeleton evaluated_pose;
+    tCompressedAnimation clip;
+    // The first frame of the animation, which is read-only
+    // after loading, and shared by every rig using the animation
+    tSkeleton reference_pose;
+    uint16 total_frames = 0;
     std::string name = "";
     bool looping = true;
     bool use_root_motion = false;
@@ -488,6 +520,13 @@ namespace astro {
     float next_animation_speed = 0.f;
     float upper_body_animation_time = 0.f;
     float upper_body_animation_speed = 0.f;
+
+    // Per-rig poses evaluated from the current/next/upper body
+    // animations, so rigs sharing animations can be evaluated
+    // independently of one another
+    tSkeleton current_pose;
+    tSkeleton next_pose;
+    tSkeleton upper_body_pose;
   };
 
   /**
@@ -535,6 +574,61 @@ namespace astro {
     SUBSTORY_SEEKER_STARGAZER
   };
 
+  /**
+   * ----------------------------
+   * The shared state read by entity types which time-evolve in
+   * parallel, recorded per type when evolved, so static types can
+   * be skipped while none of it has changed.
+   * ----------------------------
+   */
+  struct EntityEvolutionInputs {
+    float astro_time = 0.f;
+    tVec3f player_position;
+    float water_level = 0.f;
+    Location current_location = LOCATION_UNSPECIFIED;
+    bool use_vantage_camera = false;
+    bool is_valid = false;
+  };
+
+  /**
+   * ----------------------------
+   * Targetable enemies, bucketed into xz grid cells. Kept up to
+   * date as enemies spawn, despawn and move, so targeting only
+   * needs to check the cells around the player.
+   * ----------------------------
+   */
+  struct TargetableIndex {
+    std::unordered_map<uint64, std::vector<EntityRecord>> cells;
+    // The cell key each indexed entity is in, by entity id
+    std::unordered_map<int32, uint64> entity_cells;
+  };
+
+  /**
+   * ----------------------------
+   * Symbols for the entity names game code checks against,
+   * interned once at startup.
+   * ----------------------------
+   */
+  struct NameSymbols {
+    uint32 tutorial = 0;
+    uint32 divination_woodrealm = 0;
+    uint32 riverway = 0;
+    uint32 promenade = 0;
+    uint32 lakefront_south = 0;
+    uint32 garden = 0;
+    uint32 swing_lamp = 0;
+    uint32 game_start_chimes = 0;
+    uint32 distant_past = 0;
+    uint32 tutorial_bird = 0;
+    uint32 lake_girl = 0;
+    uint32 gate_guard = 0;
+    uint32 gate_villager = 0;
+    uint32 dweller_river = 0;
+  };
+
+  // Defined in procedural_generation.cpp
+  struct ProceduralRebuild;
+
   /**
    * ----------------------------
    * Game state
@@ -543,6 +637,26 @@ namespace astro {
   struct State : EntityContainers {
     MeshIds meshes;
 
+    // Maps entity ids to their indexes in their type's container.
+    // Entity ids are never reused, so the id doubles as the handle
+    // generation: deleted entities map to -1, and lookups verify
+    // that the entity at the mapped index still has the same id.
+    std::vector<int32> entity_index_by_id;
+
+    // Interned entity names, and the entities they belong to.
+    // Symbol 0 is reserved for the empty name.
+    std::unordered_map<std::string, uint32> entity_name_symbols;
+    std::unordered_map<uint32, EntityRecord> entity_records_by_name_symbol;
+    NameSymbols name_symbols;
+
+    // Inputs each entity type was last time-evolved with, indexed by type.
+    // Cleared whenever entities are added, removed or edited.
+    std::vector<EntityEvolutionInputs> entity_evolution_inputs;
+
+    // Inputs bush flowers were last placed with.
+    // Reset whenever the bush flowers are regenerated.
+    uint32 bush_flower_inputs_hash = 0;
+
     float dt = 0.f;
 
     // Player attributes
@@ -686,7 +800,21 @@ namespace astro {
     std::vector<PathSegment> dirt_path_segments;
     std::vector<PathSegment> stone_path_segments;
     std::vector<GrassChunk> grass_chunks;
+    // Maps small grass grid cells to grass chunk indexes, or -1
+    std::vector<int32> grass_chunk_grid;
+    // Grass chunk indexes, by the instance slot they occupy
+    std::vector<int32> resident_grass_chunks;
     std::vector<GroundPlantCluster> ground_plant_clusters;
+    // Incremented whenever the path segments are regenerated, so
+    // rebuilds generated against older segments can be discarded
+    uint32 path_generation = 0;
+    // The background procedural rebuild in progress, if any.
+    // Its worker is always joined before it is deleted.
+    ProceduralRebuild* procedural_rebuild = nullptr;
+
+    // Ground flower object ids, cached by the astro time they were last committed at
+    AstroTimeCache ground_flower_cache;
+    AstroTimeCache tiny_ground_flower_cache;
 
     // Flat ground planes, sorted by descending y for world xz height queries
     std::vector<Plane> flat_ground_planes;
@@ -698,6 +826,9 @@ namespace astro {
     float target_start_time = 0.f;
     bool has_target = false;
     std::vector<EntityRecord> targetable_entities;
+    // Positions of each targetable entity, in the same order
+    std::vector<tVec3f> targetable_positions;
+    TargetableIndex targetable_index;
 
     // Camera attributes
     tVec3f camera_tracking_position;
@@ -749,15 +880,18 @@ namespace astro {
     int32 wand_hint_light_id = -1;
 
     // Dynamic fauna
-    std::vector<Butterfly> butterflies;
+    ButterflySwarm butterflies;
     std::vector<TinyBird> tiny_birds;
     std::vector<Duck> ducks;
     std::vector<Swan> swans;
+    // Bird spawn positions, for finding spawns near the player.
+    // Rebuilt whenever the bird spawns may have changed.
+    tSpatialGrid bird_spawn_grid;
     float last_tiny_bird_spawn_time = 0.f;
     float tiny_bird_cooldown_time = 0.f;
 
     // Particles
-    std::vector<FlowerParticle> flower_particles;
+    tParticlePool flower_particles;
     std::vector<int32> sculpture_particles;
     std::vector<int32> glow_particle_light_ids;
     float glow_particles_alpha = 0.f;
@@ -785,6 +919,9 @@ namespace astro {
     bool dismissed_blocking_dialogue = false;
     std::unordered_map<std::string, DialogueSet> dialogue_map;
     std::string current_dialogue_set = "";
+    // The entity name symbol for the current dialogue set, so
+    // talking entities can be matched without string comparisons
+    uint32 current_dialogue_set_symbol = 0;
     int32 current_dialogue_step = 0;
 
     // Events
@@ -1,13 +1,13 @@
+#include <algorithm>
 #include <format>
 #include <map>
 #include <string>
-#include <thread>
 #include <vector>
 
 #include "astro/level_editor.h"
 #include "astro/collision_system.h"
-#include "astro/data_loader.h"
 #include "astro/decorative_meshes.h"
+#include "astro/edit_journal.h"
 #include "astro/entity_manager.h"
 #include "astro/entity_dispatcher.h"
 #include "astro/items.h"
@@ -29,6 +29,11 @@ struct Selectable {
 
 struct LevelEditorState {
   std::vector<Selectable> selectables;
+  // Pick spheres around each selectable, rebuilt lazily whenever
+  // selectables are added or removed
+  tBVH selectables_bvh;
+  std::vector<uint32> selectable_candidates;
+  bool is_selectables_bvh_dirty = true;
   // @todo allow multiple?
   Selectable current_selectable;
   GizmoAction current_gizmo_action = POSITION;
@@ -58,6 +63,10 @@ struct LevelEditorState {
   tVec3f move_action_delta = tVec3f(0.f);
 
   bool should_rebuild_all_procedural_objects = false;
+
+  EditLog edit_log;
+  // The saved properties of the current selectable when it was selected
+  LevelRecord selected_record;
 } editor;
 
 const static EntityDefaults missing_entity_defaults = {
@@ -157,119 +166,13 @@ static DecorativeMesh& GetDecorativeMeshDefaults(State& state, uint16 mesh_index
 
 /**
  * ----------------------------
- * Serialization helpers for different data types.
+ * Formats a float the same way it is written to level data.
  * ----------------------------
  */
 static inline std::string Serialize(float f) {
   return std::format("{:.3f}", f);
 }
 
-static inline std::string Serialize(bool value) {
-  return value ? "1" : "";
-}
-
-static inline std::string Serialize(const tVec3f& vector) {
-  return (
-    Serialize(vector.x) + "," +
-    Serialize(vector.y) + "," +
-    Serialize(vector.z)
-  );
-}
-
-static inline std::string Serialize(const Quaternion& quaternion) {
-  return (
-    Serialize(quaternion.w) + "," +
-    Serialize(quaternion.x) + "," +
-    Serialize(quaternion.y) + "," +
-    Serialize(quaternion.z)
-  );
-}
-
-static inline std::string Serialize(tColor& color) {
-  return std::to_string(color.rgba);
-}
-
-/**
- * ----------------------------
- * Converts an entity into a condensed string representation
- * for storage in a level data file.
- * ----------------------------
- */
-std::string SerializeEntity(const GameEntity& entity) {
-  return (
-    Serialize(entity.position) + "," +
-    Serialize(entity.scale) + "," +
-    Serialize(entity.orientation) + "," +
-    Serialize(entity.tint) + "," +
-    Serialize(entity.astro_start_time) + "," +
-    Serialize(entity.astro_end_time) + "," +
-    entity.item_pickup_name + "," +
-    entity.unique_name + "," +
-    entity.associated_entity_name + "," +
-    Serialize(entity.requires_action)
-  );
-}
-
-/**
- * ----------------------------
- * Converts an object into a condensed string representation
- * for storage in a level data file.
- * ----------------------------
- */
-std::string SerializeObject(State& state, tObject& object) {
-  return (
-    "$" +
-    std::to_string(DataLoader::MeshIndexToId(state, object.mesh_index)) + "," +
-    Serialize(object.position) + "," +
-    Serialize(object.scale) + "," +
-    Serialize(object.rotation) + "," +
-    Serialize(object.color)
-  );
-}
-
-/**
- * ----------------------------
- * Writes all entities/objects in the level to a file.
- * ----------------------------
- */
-void SaveLevelData(Tachyon* tachyon, State& state) {
-  log_time("SaveLevelData()");
-
-  std::string level_data = "";
-
-  for_all_entity_types() {
-    auto& entity_defaults = GetEntityDefaults(type);
-
-    level_data += "@" + entity_defaults.name + "\n";
-
-    for_entities_of_type(type) {
-      auto& entity = entities[i];
-
-      level_data += SerializeEntity(entity) + "\n";
-    }
-  }
-
-  // Delimiter between entities and static decorative mesh objects
-  level_data += "====\n";
-
-  for (auto& decorative : GetDecorativeMeshes(state)) {
-    auto& objects = objects(decorative.mesh_index);
-
-    // Perform a sequence-preserving loop over the objects
-    // to ensure they always serialize in the same order
-    // (e.g. if objects are removed/shuffled during runtime)
-    for (uint16 id = 0; id <= objects.highest_used_id; id++) {
-      tObject* object = objects.getById(id);
-
-      if (object != nullptr) {
-        level_data += SerializeObject(state, *object) + "\n";
-      }
-    }
-  }
-
-  Tachyon_WriteFileContents("./astro/level_data/overworld.txt", level_data);
-}
-
 /**
  * ----------------------------
  * Finds the global axis most similar to a given vector.
@@ -440,6 +343,8 @@ static void TrackDecorativeObject(tObject& object) {
     .is_entity = false,
     .placeholder = object
   });
+
+  editor.is_selectables_bvh_dirty = true;
 }
 
 /**
@@ -454,6 +359,8 @@ static void TrackSelectableEntity(GameEntity& entity, tObject& placeholder) {
     .entity_record = GetRecord(entity),
     .placeholder = placeholder,
   });
+
+  editor.is_selectables_bvh_dirty = true;
 }
 
 /**
@@ -479,6 +386,7 @@ static void ForgetSelectableEntity(int32 entity_id) {
   for (size_t i = 0; i < editor.selectables.size(); i++) {
     if (entity_id == editor.selectables[i].entity_record.id) {
       editor.selectables.erase(editor.selectables.begin() + i);
+      editor.is_selectables_bvh_dirty = true;
 
       break;
     }
@@ -494,6 +402,69 @@ static void ForgetSelectableObject(tObject& object) {
   for (size_t i = 0; i < editor.selectables.size(); i++) {
     if (object == editor.selectables[i].placeholder) {
       editor.selectables.erase(editor.selectables.begin() + i);
+      editor.is_selectables_bvh_dirty = true;
+
+      break;
+    }
+  }
+}
+
+/**
+ * ----------------------------
+ * Returns the bounds of the sphere within which a selectable
+ * can be picked from.
+ * ----------------------------
+ */
+static tBounds GetSelectableBounds(const tObject& live_placeholder) {
+  float distance_limit = live_placeholder.scale.magnitude() * 10.f;
+
+  return Tachyon_GetSphereBounds(live_placeholder.position, distance_limit);
+}
+
+/**
+ * ----------------------------
+ * Rebuilds the selectables BVH if selectables have been
+ * added or removed since it was last built.
+ * ----------------------------
+ */
+static void MaybeRebuildSelectablesBVH(Tachyon* tachyon) {
+  if (!editor.is_selectables_bvh_dirty) {
+    return;
+  }
+
+  // @allocation
+  std::vector<tBounds> bounds;
+
+  bounds.reserve(editor.selectables.size());
+
+  for (auto& selectable : editor.selectables) {
+    auto& live_placeholder = *get_live_object(selectable.placeholder);
+
+    bounds.push_back(GetSelectableBounds(live_placeholder));
+  }
+
+  Tachyon_BuildBVH(editor.selectables_bvh, bounds);
+
+  editor.is_selectables_bvh_dirty = false;
+}
+
+/**
+ * ----------------------------
+ * Refits the BVH leaf of a selectable after it has been moved or scaled.
+ * ----------------------------
+ */
+static void RefitSelectable(Tachyon* tachyon, const tObject& placeholder) {
+  if (editor.is_selectables_bvh_dirty) {
+    return;
+  }
+
+  for (uint32 i = 0; i < editor.selectables.size(); i++) {
+    auto& selectable = editor.selectables[i];
+
+    if (selectable.placeholder == placeholder) {
+      auto& live_placeholder = *get_live_object(selectable.placeholder);
+
+      Tachyon_UpdateBVHItem(editor.selectables_bvh, i, GetSelectableBounds(live_placeholder));
 
       break;
     }
@@ -905,11 +876,11 @@ static void HandleEntityPropertiesEditor(Tachyon* tachyon, State& state) {
     }
     // 4. unique_name
     else if (editor.editing_entity_step == 3) {
-      entity->unique_name = property_value;
+      EntityManager::SetUniqueName(state, *entity, property_value);
     }
     // 5. associated_entity_name
     else if (editor.editing_entity_step == 4) {
-      entity->associated_entity_name = property_value;
+      EntityManager::SetAssociatedEntityName(state, *entity, property_value);
     }
     // 6. requires_action
     else if (editor.editing_entity_step == 5) {
@@ -995,6 +966,80 @@ static void SetCurrentDecorativeMeshTypeFromSelectable(State& state, Selectable&
   }
 }
 
+/**
+ * ----------------------------
+ * Finds the Selectable for an entity by entity ID.
+ * ----------------------------
+ */
+static Selectable* FindSelectableEntity(int32 entity_id) {
+  for (auto& selectable : editor.selectables) {
+    if (selectable.is_entity && selectable.entity_record.id == entity_id) {
+      return &selectable;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * ----------------------------
+ * Determines whether changes to objects of a given mesh
+ * affect procedurally-generated objects.
+ * ----------------------------
+ */
+static bool AffectsProceduralObjects(State& state, uint16 mesh_index) {
+  auto& meshes = state.meshes;
+
+  return (
+    mesh_index == meshes.flat_ground ||
+    mesh_index == meshes.ground_1 ||
+    mesh_index == meshes.dirt_path_node_placeholder ||
+    mesh_index == meshes.stone_path_node_placeholder ||
+    mesh_index == meshes.altar_placeholder ||
+    mesh_index == meshes.wind_chimes_placeholder
+  );
+}
+
+/**
+ * ----------------------------
+ * Returns the saved properties of the current selectable.
+ * ----------------------------
+ */
+static LevelRecord GetSelectedLevelRecord(Tachyon* tachyon, State& state) {
+  auto& selected = editor.current_selectable;
+
+  if (selected.is_entity) {
+    auto& entity = *EntityManager::FindEntity(state, selected.entity_record);
+
+    return EditJournal::GetLevelRecord(entity);
+  }
+
+  return EditJournal::GetLevelRecord(*get_live_object(selected.placeholder));
+}
+
+/**
+ * ----------------------------
+ * Records any changes made to the current selectable
+ * since it was selected.
+ * ----------------------------
+ */
+static void RecordSelectionEdits(Tachyon* tachyon, State& state) {
+  auto& selected = editor.current_selectable;
+  LevelRecord record = GetSelectedLevelRecord(tachyon, state);
+
+  if (!EditJournal::HasChanged(editor.selected_record, record)) {
+    return;
+  }
+
+  if (selected.is_entity) {
+    EditJournal::RecordEntityEdit(editor.edit_log, EDIT_MODIFY, selected.entity_record, editor.selected_record, record);
+  } else {
+    EditJournal::RecordObjectEdit(editor.edit_log, EDIT_MODIFY, selected.placeholder, editor.selected_record, record);
+  }
+
+  editor.selected_record = record;
+}
+
 /**
  * ----------------------------
  * Selects a given Selectable, either an entity or plain object.
@@ -1004,6 +1049,7 @@ static void MakeSelection(Tachyon* tachyon, State& state, Selectable& selectable
   editor.is_anything_selected = true;
   editor.current_selectable = selectable;
   editor.current_gizmo_action = POSITION;
+  editor.selected_record = GetSelectedLevelRecord(tachyon, state);
 
   auto& placeholder = editor.current_selectable.placeholder;
 
@@ -1036,7 +1082,6 @@ static void MakeSelection(Tachyon* tachyon, State& state, Selectable& selectable
  * ----------------------------
  */
 static void DeselectCurrent(Tachyon* tachyon, State& state) {
-  auto& meshes = state.meshes;
   auto& placeholder = editor.current_selectable.placeholder;
   auto& live_placeholder = *get_live_object(placeholder);
 
@@ -1047,6 +1092,8 @@ static void DeselectCurrent(Tachyon* tachyon, State& state) {
 
   commit(live_placeholder);
 
+  RecordSelectionEdits(tachyon, state);
+
   editor.is_anything_selected = false;
   editor.current_selectable.entity_record.type = UNSPECIFIED;
   editor.current_selectable.entity_record.id = -1;
@@ -1055,7 +1102,9 @@ static void DeselectCurrent(Tachyon* tachyon, State& state) {
   StopEditingEntityProperties(tachyon);
   DestroyGizmo(tachyon, state);
   SyncSelectables(tachyon);
-  SaveLevelData(tachyon, state);
+  RefitSelectable(tachyon, placeholder);
+
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
 
   ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(tachyon, state);
 
@@ -1065,15 +1114,7 @@ static void DeselectCurrent(Tachyon* tachyon, State& state) {
     tachyon->hotkeys_enabled = true;
   }
 
-  // @todo factor
-  if (
-    placeholder.mesh_index == meshes.flat_ground ||
-    placeholder.mesh_index == meshes.ground_1 ||
-    placeholder.mesh_index == meshes.dirt_path_node_placeholder ||
-    placeholder.mesh_index == meshes.stone_path_node_placeholder ||
-    placeholder.mesh_index == meshes.altar_placeholder ||
-    placeholder.mesh_index == meshes.wind_chimes_placeholder
-  ) {
+  if (AffectsProceduralObjects(state, placeholder.mesh_index)) {
     // After manipulating ground or path-related objects,
     // or any objects which affect procedural ground foliage,
     // ensure that we do a full procedural rebuild upon
@@ -1094,7 +1135,19 @@ static void MaybeMakeSelection(Tachyon* tachyon, State& state) {
   float highest_candidate_score = 0.f;
   Selectable candidate;
 
-  for (auto& selectable : editor.selectables) {
+  MaybeRebuildSelectablesBVH(tachyon);
+
+  // Only selectables whose pick spheres contain the camera can be in range.
+  // Visit them in list order so ties resolve the same way as a full scan.
+  auto& candidates = editor.selectable_candidates;
+
+  Tachyon_QueryBVHPoint(editor.selectables_bvh, camera.position, candidates);
+
+  std::sort(candidates.begin(), candidates.end());
+
+  for (uint32 index : candidates) {
+    auto& selectable = editor.selectables[index];
+
     if (objects(selectable.placeholder.mesh_index).disabled) continue;
 
     auto& live_placeholder = *get_live_object(selectable.placeholder);
@@ -1278,6 +1331,9 @@ static void PlaceNewDecorativeObject(Tachyon* tachyon, State& state) {
 
   TrackDecorativeObject(object);
 
+  EditJournal::RecordObjectEdit(editor.edit_log, EDIT_CREATE, object, LevelRecord(), EditJournal::GetLevelRecord(object));
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
+
   ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(tachyon, state);
 }
 
@@ -1312,6 +1368,9 @@ static void PlaceNewEntity(Tachyon* tachyon, State& state) {
 
   SpawnEntityObjects(tachyon, state, entity);
 
+  EditJournal::RecordEntityEdit(editor.edit_log, EDIT_CREATE, GetRecord(entity), LevelRecord(), EditJournal::GetLevelRecord(entity));
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
+
   ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(tachyon, state);
 }
 
@@ -1724,26 +1783,56 @@ static void RemoveLastObject(Tachyon* tachyon, uint16 mesh_index) {
   }
 }
 
+/**
+ * ----------------------------
+ * Removes an entity, along with its placeholder and objects.
+ * ----------------------------
+ */
+static void RemoveEntity(Tachyon* tachyon, State& state, const EntityRecord& record) {
+  Selectable* selectable = FindSelectableEntity(record.id);
+
+  if (selectable != nullptr) {
+    remove_object(selectable->placeholder);
+  }
+
+  ForgetSelectableEntity(record.id);
+
+  auto& entity = *EntityManager::FindEntity(state, record);
+
+  if (entity.light_id > -1) {
+    remove_point_light(entity.light_id);
+  }
+
+  EntityManager::DeleteEntity(state, record);
+
+  // Remove objects associated with the entity
+  auto& mesh_ids = EntityDispatcher::GetMeshes(state, record.type);
+
+  for (auto mesh_id : mesh_ids) {
+    RemoveLastObject(tachyon, mesh_id);
+  }
+}
+
+/**
+ * ----------------------------
+ * Removes a decorative object.
+ * ----------------------------
+ */
+static void RemoveDecorativeObject(Tachyon* tachyon, tObject object) {
+  remove_object(object);
+
+  ForgetSelectableObject(object);
+}
+
 /**
  * ----------------------------
  * Deletes the currently-selected entity or object.
  * ----------------------------
  */
 static void DeleteSelected(Tachyon* tachyon, State& state) {
-  auto& meshes = state.meshes;
   auto& selected = editor.current_selectable;
 
-  remove_object(selected.placeholder);
-
-  // @todo factor
-  if (
-    selected.placeholder.mesh_index == meshes.flat_ground ||
-    selected.placeholder.mesh_index == meshes.ground_1 ||
-    selected.placeholder.mesh_index == meshes.dirt_path_node_placeholder ||
-    selected.placeholder.mesh_index == meshes.stone_path_node_placeholder ||
-    selected.placeholder.mesh_index == meshes.altar_placeholder ||
-    selected.placeholder.mesh_index == meshes.wind_chimes_placeholder
-  ) {
+  if (AffectsProceduralObjects(state, selected.placeholder.mesh_index)) {
     // After manipulating ground or path-related objects,
     // or any objects which affect procedural ground foliage,
     // ensure that we do a full procedural rebuild upon
@@ -1751,32 +1840,219 @@ static void DeleteSelected(Tachyon* tachyon, State& state) {
     editor.should_rebuild_all_procedural_objects = true;
   }
 
+  // Keep any changes made before deleting, so undoing
+  // the deletion restores the selectable as it was
+  RecordSelectionEdits(tachyon, state);
+
   if (selected.is_entity) {
-    ForgetSelectableEntity(selected.entity_record.id);
+    EditJournal::RecordEntityEdit(editor.edit_log, EDIT_DELETE, selected.entity_record, editor.selected_record, LevelRecord());
 
-    auto& entity = *EntityManager::FindEntity(state, selected.entity_record);
+    RemoveEntity(tachyon, state, selected.entity_record);
+  } else {
+    EditJournal::RecordObjectEdit(editor.edit_log, EDIT_DELETE, selected.placeholder, editor.selected_record, LevelRecord());
+
+    RemoveDecorativeObject(tachyon, selected.placeholder);
+  }
+
+  DestroyGizmo(tachyon, state);
+
+  ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(tachyon, state);
+
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
+
+  editor.is_anything_selected = false;
+}
+
+/**
+ * ----------------------------
+ * Copies the saved properties in a level record to an entity,
+ * apart from its names.
+ * ----------------------------
+ */
+static void ApplyLevelRecord(GameEntity& entity, const LevelRecord& record) {
+  entity.position = record.position;
+  entity.scale = record.scale;
+  entity.orientation = record.rotation;
+  entity.tint = record.tint;
+  entity.astro_start_time = record.astro_start_time;
+  entity.astro_end_time = record.astro_end_time;
+  entity.item_pickup_name = record.item_pickup_name;
+  entity.requires_action = record.requires_action;
+
+  entity.visible_position = entity.position;
+  entity.visible_rotation = entity.orientation;
+  entity.visible_scale = entity.scale;
+}
 
-    if (entity.light_id > -1) {
-      remove_point_light(entity.light_id);
+/**
+ * ----------------------------
+ * Copies the saved properties in a level record to an object.
+ * ----------------------------
+ */
+static void ApplyLevelRecord(tObject& object, const LevelRecord& record) {
+  object.position = record.position;
+  object.scale = record.scale;
+  object.rotation = record.rotation;
+  object.color = record.color;
+  object.material = record.material;
+}
+
+/**
+ * ----------------------------
+ * Re-creates a deleted entity or object from its saved properties,
+ * and points its edit subject at the new entity or object ID.
+ * ----------------------------
+ */
+static void RestoreEditSubject(Tachyon* tachyon, State& state, EditSubject& subject, const LevelRecord& record) {
+  if (subject.is_entity) {
+    GameEntity entity = EntityManager::CreateNewEntity(state, record.entity_type);
+
+    ApplyLevelRecord(entity, record);
+
+    entity.unique_name = record.unique_name;
+    entity.associated_entity_name = record.associated_entity_name;
+
+    // @temporary
+    if (entity.type == LAMPPOST && !entity.requires_action) {
+      entity.did_activate = true;
     }
 
-    EntityManager::DeleteEntity(state, selected.entity_record);
+    EntityManager::SaveNewEntity(state, entity);
 
-    // Remove objects associated with the entity
-    auto& mesh_ids = EntityDispatcher::GetMeshes(state, selected.entity_record.type);
+    SpawnEntityObjects(tachyon, state, entity);
 
-    for (auto mesh_id : mesh_ids) {
-      RemoveLastObject(tachyon, mesh_id);
+    subject.entity_record = GetRecord(entity);
+  } else {
+    auto& object = create(record.mesh_index);
+
+    ApplyLevelRecord(object, record);
+    commit(object);
+
+    TrackDecorativeObject(object);
+
+    subject.object_id = object.object_id;
+  }
+}
+
+/**
+ * ----------------------------
+ * Removes an entity or object being undone or redone.
+ * ----------------------------
+ */
+static void RemoveEditSubject(Tachyon* tachyon, State& state, const EditSubject& subject) {
+  if (subject.is_entity) {
+    RemoveEntity(tachyon, state, subject.entity_record);
+  } else {
+    tObject object;
+    object.mesh_index = subject.mesh_index;
+    object.object_id = subject.object_id;
+
+    RemoveDecorativeObject(tachyon, object);
+  }
+}
+
+/**
+ * ----------------------------
+ * Sets the saved properties of an entity or object being
+ * undone or redone, along with its placeholder.
+ * ----------------------------
+ */
+static void ModifyEditSubject(Tachyon* tachyon, State& state, const EditSubject& subject, const LevelRecord& record) {
+  tObject* live_placeholder = nullptr;
+
+  if (subject.is_entity) {
+    auto& entity = *EntityManager::FindEntity(state, subject.entity_record);
+    Selectable* selectable = FindSelectableEntity(entity.id);
+
+    ApplyLevelRecord(entity, record);
+
+    EntityManager::SetUniqueName(state, entity, record.unique_name);
+    EntityManager::SetAssociatedEntityName(state, entity, record.associated_entity_name);
+
+    if (selectable != nullptr) {
+      live_placeholder = get_live_object(selectable->placeholder);
+
+      live_placeholder->position = entity.position;
+      live_placeholder->scale = entity.scale;
+      live_placeholder->rotation = entity.orientation;
     }
   } else {
-    ForgetSelectableObject(selected.placeholder);
+    tObject object;
+    object.mesh_index = subject.mesh_index;
+    object.object_id = subject.object_id;
+
+    live_placeholder = get_live_object(object);
+
+    ApplyLevelRecord(*live_placeholder, record);
   }
 
-  DestroyGizmo(tachyon, state);
+  if (live_placeholder != nullptr) {
+    commit(*live_placeholder);
+
+    SyncSelectables(tachyon);
+    RefitSelectable(tachyon, *live_placeholder);
+  }
+}
+
+/**
+ * ----------------------------
+ * Undoes or redoes an edit, then saves the level.
+ * ----------------------------
+ */
+static void ApplyEdit(Tachyon* tachyon, State& state, const EditOperation& operation, bool undo) {
+  auto& subject = editor.edit_log.subjects[operation.subject];
+  const LevelRecord& record = undo ? operation.before : operation.after;
+
+  if (
+    (operation.type == EDIT_CREATE && undo) ||
+    (operation.type == EDIT_DELETE && !undo)
+  ) {
+    RemoveEditSubject(tachyon, state, subject);
+  } else if (operation.type == EDIT_MODIFY) {
+    ModifyEditSubject(tachyon, state, subject, record);
+  } else {
+    RestoreEditSubject(tachyon, state, subject, record);
+  }
+
+  uint16 mesh_index = subject.is_entity
+    ? EntityDispatcher::GetPlaceholderMesh(state, subject.entity_record.type)
+    : subject.mesh_index;
+
+  if (AffectsProceduralObjects(state, mesh_index)) {
+    editor.should_rebuild_all_procedural_objects = true;
+  }
 
   ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(tachyon, state);
 
-  editor.is_anything_selected = false;
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
+}
+
+static void UndoLastEdit(Tachyon* tachyon, State& state) {
+  auto* operation = EditJournal::Undo(editor.edit_log);
+
+  if (operation == nullptr) {
+    show_overlay_message("Nothing to undo");
+
+    return;
+  }
+
+  ApplyEdit(tachyon, state, *operation, true);
+
+  show_overlay_message("Undo");
+}
+
+static void RedoLastEdit(Tachyon* tachyon, State& state) {
+  auto* operation = EditJournal::Redo(editor.edit_log);
+
+  if (operation == nullptr) {
+    show_overlay_message("Nothing to redo");
+
+    return;
+  }
+
+  ApplyEdit(tachyon, state, *operation, false);
+
+  show_overlay_message("Redo");
 }
 
 /**
@@ -2069,6 +2345,14 @@ static void HandleEditorActions(Tachyon* tachyon, State& state) {
     if (did_press_key(tKey::R)) {
       RepositionPlayer(tachyon, state);
     }
+
+    if (did_press_key(tKey::Z) && !is_key_held(tKey::SHIFT)) {
+      UndoLastEdit(tachyon, state);
+    }
+
+    if (did_press_key(tKey::Z) && is_key_held(tKey::SHIFT)) {
+      RedoLastEdit(tachyon, state);
+    }
   }
 }
 
@@ -2176,6 +2460,18 @@ static void HandleUI(Tachyon* tachyon, State& state) {
     .string = "Level Editor"
   });
 
+  if (state.is_rebuilding_procedural_objects) {
+    int32 percent = int32(ProceduralBehavior::Generation::GetProceduralRebuildProgress(state) * 100.f);
+
+    Tachyon_DrawUIText(tachyon, state.debug_text, {
+      .screen_x = tachyon->window_width / 2,
+      .screen_y = tachyon->window_height - 40,
+      .centered = true,
+      .color = tVec3f(1.f),
+      .string = "Rebuilding procedural objects (" + std::to_string(percent) + "%)"
+    });
+  }
+
   if (editor.is_in_placement_mode) {
     if (editor.is_placing_entity) {
       DisplayEntityPlacementLabels(tachyon, state);
@@ -2259,6 +2555,11 @@ void LevelEditor::OpenLevelEditor(Tachyon* tachyon, State& state) {
   }
 
   editor.selectables.clear();
+  editor.is_selectables_bvh_dirty = true;
+
+  // Entities and objects may have changed in-game since the editor
+  // was last open, so don't carry over edits to undo
+  EditJournal::Reset(editor.edit_log);
 
   SpawnEntityPlaceholders(tachyon, state);
   TrackDecorativeObjects(tachyon, state);
@@ -2324,10 +2625,17 @@ void LevelEditor::CloseLevelEditor(Tachyon* tachyon, State& state) {
 
   state.is_level_editor_open = false;
 
+  // Entities may have been edited, so evolve every entity type again
+  state.entity_evolution_inputs.clear();
+
+  // Bird spawns may have been moved, so rebuild their grid
+  state.bird_spawn_grid = tSpatialGrid();
+
   // Reset target/speaking entity state so we can delete targeted entities
   // without crashing upon returning to the game
   {
     state.targetable_entities.clear();
+    state.targetable_positions.clear();
 
     state.speaking_entity_record.type = UNSPECIFIED;
     state.speaking_entity_record.id = -1;
@@ -2375,20 +2683,16 @@ void LevelEditor::CloseLevelEditor(Tachyon* tachyon, State& state) {
   CollisionSystem::RebuildFlatGroundPlanes(tachyon, state);
 
   if (editor.should_rebuild_all_procedural_objects) {
-    state.is_rebuilding_procedural_objects = true;
-
-    // Offload the procedural rebuild work to another thread
-    std::thread builder_thread([tachyon, &state]() {
-      ProceduralBehavior::Generation::RebuildAllProceduralObjects(tachyon, state);
-    });
-
-    builder_thread.detach();
+    // Generate procedural objects in the background,
+    // replacing any rebuild which is still in progress
+    ProceduralBehavior::Generation::StartProceduralRebuild(tachyon, state);
   }
 
   Items::SpawnItemObjects(tachyon, state);
   EntityManager::CreateEntityAssociations(state);
 
-  SaveLevelData(tachyon, state);
+  EditJournal::SaveLevelData(tachyon, state, editor.edit_log);
+  EditJournal::CompactLevelData(tachyon, state);
   RemoveEntityPlaceholders(tachyon, state);
 
   if (editor.is_in_placement_mode) {
@@ -2398,4 +2702,5 @@ void LevelEditor::CloseLevelEditor(Tachyon* tachyon, State& state) {
   }
 
   editor.selectables.clear();
+  editor.is_selectables_bvh_dirty = true;
 }
\ No newline at end of file
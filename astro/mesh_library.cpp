@@ -106,7 +106,9 @@ static void AddProceduralMeshes(Tachyon* tachyon, State& state) {
 
   // small_grass
   {
-    meshes.small_grass = MODEL_MESH_LOD_2("./astro/3d_models/small_grass.obj", "./astro/3d_models/small_grass_lod.obj", 50000);
+    // Small grass chunks are written into fixed instance ranges of
+    // 4500 blades each, so make room for 13 resident chunks
+    meshes.small_grass = MODEL_MESH_LOD_2("./astro/3d_models/small_grass.obj", "./astro/3d_models/small_grass_lod.obj", 58500);
 
     mesh(meshes.small_grass).type = GRASS_MESH;
     mesh(meshes.small_grass).shadow_cascade_ceiling = 2;
@@ -451,6 +453,8 @@ void MeshLibrary::AddMeshes(Tachyon* tachyon, State& state) {
   meshes.river_leaf = MODEL_MESH("./astro/3d_models/river_leaf.obj", 500);
   meshes.dust_mote = SPHERE_MESH(1000, 6);
   meshes.dust_cloud = MODEL_MESH("./astro/3d_models/dust_cloud.obj", 10);
+  // One per flower particle
+  meshes.flower_particle = SPHERE_MESH(500, 6);
 
   mesh(meshes.water_plane).type = WATER_MESH;
   mesh(meshes.water_plane).shadow_cascade_ceiling = 0;
@@ -462,6 +466,8 @@ void MeshLibrary::AddMeshes(Tachyon* tachyon, State& state) {
   // @temporary @todo use GLOW_PARTICLE_MESH once it exists
   mesh(meshes.dust_mote).type = VOLUMETRIC_MESH;
   mesh(meshes.dust_mote).shadow_cascade_ceiling = 0;
+  mesh(meshes.flower_particle).type = VOLUMETRIC_MESH;
+  mesh(meshes.flower_particle).shadow_cascade_ceiling = 0;
 
   mesh(meshes.dust_cloud).shadow_cascade_ceiling = 0;
 
@@ -3,6 +3,8 @@
 
 using namespace astro;
 
+#define MAX_FLOWER_PARTICLES 500
+
 const static float angle_offsets[] = {
   0.6f,
   -0.8f,
@@ -163,76 +165,68 @@ static void HandleSculptureParticles(Tachyon* tachyon, State& state) {
   }
 }
 
-// @todo move to engine
-template<class T>
-static inline void RemoveFromArray(std::vector<T>& array, uint32 index) {
-  array.erase(array.begin() + index);
-}
-
-static bool EntityHasFlowerParticle(State& state, const GameEntity& entity) {
-  for (auto& particle : state.flower_particles) {
-    if (particle.spawning_entity_id == entity.id) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
 static void SpawnFlowerParticles(Tachyon* tachyon, State& state, const GameEntity& spawning_entity) {
-  // Create + add particle
-  FlowerParticle particle;
-  particle.spawn_time = get_scene_time();
-  particle.lifetime = Tachyon_GetRandom(3.f, 4.f);
-  particle.spawn_position = spawning_entity.position;
-  particle.light_id = create_point_light();
-  particle.spawning_entity_id = spawning_entity.id;
+  auto& particles = state.flower_particles;
+  int32 light_id = create_point_light();
+
+  int32 index = Tachyon_SpawnParticle(
+    particles,
+    spawning_entity.id,
+    spawning_entity.position,
+    tVec3f(0.f),
+    get_scene_time(),
+    Tachyon_GetRandom(3.f, 4.f),
+    light_id
+  );
+
+  if (index == -1) {
+    remove_point_light(light_id);
+
+    return;
+  }
 
-  state.flower_particles.push_back(particle);
+  particles.positions[index].y += 2.f * spawning_entity.scale.y;
 
   // Initialize light
-  auto& light = *get_point_light(particle.light_id);
-
-  light.position = spawning_entity.position;
-  light.position.y += 2.f * spawning_entity.scale.y;
+  auto& light = *get_point_light(light_id);
 
-  light.radius = particle.radius;
-  light.color = particle.color;
+  light.position = particles.positions[index];
+  light.radius = 500.f;
+  light.color = tVec3f(1.f);
 }
 
-static void UpdateFlowerParticle(Tachyon* tachyon, State& state, FlowerParticle& particle) {
-  auto& light = *get_point_light(particle.light_id);
+static void UpdateFlowerParticleMotion(Tachyon* tachyon, State& state) {
+  auto& particles = state.flower_particles;
+  float scene_time = get_scene_time();
 
-  float alpha = time_since(particle.spawn_time) / particle.lifetime;
-  if (alpha > 1.f) alpha = 1.f;
+  for (uint32 i = 0; i < particles.total_active; i++) {
+    auto& origin = particles.origins[i];
+    float spawn_time = particles.spawn_times[i];
 
-  float speed = 750.f * (1.f - alpha);
-  float angle = alpha * t_PI + particle.spawn_time + particle.spawn_position.x;
+    float alpha = (scene_time - spawn_time) / particles.lifetimes[i];
+    if (alpha > 1.f) alpha = 1.f;
 
-  light.position.y += speed * state.dt;
+    float angle = alpha * t_PI + spawn_time + origin.x;
 
-  light.position.x = particle.spawn_position.x + 600.f * alpha * sinf(angle);
-  light.position.z = particle.spawn_position.z + 600.f * alpha * cosf(angle);
+    particles.velocities[i].y = 750.f * (1.f - alpha);
 
-  if (alpha < 0.5f) {
-    light.power = pow2(2.f * alpha);
-  } else if (alpha < 1.f) {
-    light.power = 1.f - 2.f * (alpha - 0.5f);
-  } else {
-    light.power = 0.f;
+    particles.positions[i].x = origin.x + 600.f * alpha * sinf(angle);
+    particles.positions[i].z = origin.z + 600.f * alpha * cosf(angle);
   }
 
-  light.radius = 500.f + 500.f * light.power;
+  Tachyon_IntegrateParticles(particles, state.dt);
 }
 
 static void RemoveExpiredFlowerParticles(Tachyon* tachyon, State& state) {
-  for (size_t i = 0; i < state.flower_particles.size(); i++) {
-    auto& particle = state.flower_particles[i];
+  auto& particles = state.flower_particles;
+  float scene_time = get_scene_time();
 
-    if (time_since(particle.spawn_time) > particle.lifetime) {
-      remove_point_light(particle.light_id);
+  // Iterate in reverse, since killed particles are swapped with the last one
+  for (uint32 i = particles.total_active; i-- > 0;) {
+    if (scene_time - particles.spawn_times[i] > particles.lifetimes[i]) {
+      remove_point_light(particles.handles[i]);
 
-      RemoveFromArray(state.flower_particles, i);
+      Tachyon_KillParticle(particles, i);
     }
   }
 }
@@ -248,7 +242,7 @@ static void SpawnNighttimeParticles(Tachyon* tachyon, State& state) {
       if (abs(entity.position.x - state.player_position.x) > 20000.f) continue;
       if (abs(entity.position.z - state.player_position.z) > 20000.f) continue;
 
-      if (!EntityHasFlowerParticle(state, entity)) {
+      if (!Tachyon_EmitterHasParticles(state.flower_particles, entity.id)) {
         SpawnFlowerParticles(tachyon, state, entity);
       }
     }
@@ -262,7 +256,7 @@ static void SpawnNighttimeParticles(Tachyon* tachyon, State& state) {
       if (abs(entity.position.x - state.player_position.x) > 20000.f) continue;
       if (abs(entity.position.z - state.player_position.z) > 20000.f) continue;
 
-      if (!EntityHasFlowerParticle(state, entity)) {
+      if (!Tachyon_EmitterHasParticles(state.flower_particles, entity.id)) {
         SpawnFlowerParticles(tachyon, state, entity);
       }
     }
@@ -270,9 +264,30 @@ static void SpawnNighttimeParticles(Tachyon* tachyon, State& state) {
 }
 
 static void UpdateAllFlowerParticles(Tachyon* tachyon, State& state) {
-  for (auto& particle : state.flower_particles) {
-    UpdateFlowerParticle(tachyon, state, particle);
+  auto& particles = state.flower_particles;
+
+  UpdateFlowerParticleMotion(tachyon, state);
+
+  for (uint32 i = 0; i < particles.total_active; i++) {
+    auto& light = *get_point_light(particles.handles[i]);
+
+    float alpha = time_since(particles.spawn_times[i]) / particles.lifetimes[i];
+    if (alpha > 1.f) alpha = 1.f;
+
+    light.position = particles.positions[i];
+
+    if (alpha < 0.5f) {
+      light.power = pow2(2.f * alpha);
+    } else if (alpha < 1.f) {
+      light.power = 1.f - 2.f * (alpha - 0.5f);
+    } else {
+      light.power = 0.f;
+    }
+
+    light.radius = 500.f + 500.f * light.power;
   }
+
+  Tachyon_CommitParticleInstances(tachyon, particles, state.meshes.flower_particle, tVec3f(30.f), tVec4f(1.f), tVec4f(1.f, 0, 0, 1.f));
 }
 
 void Particles::InitParticles(Tachyon* tachyon, State& state) {
@@ -283,6 +298,12 @@ void Particles::InitParticles(Tachyon* tachyon, State& state) {
   for_range(1, 50) {
     state.sculpture_particles.push_back(create_point_light());
   }
+
+  Tachyon_InitParticlePool(state.flower_particles, MAX_FLOWER_PARTICLES);
+
+  for_range(1, MAX_FLOWER_PARTICLES) {
+    create(state.meshes.flower_particle);
+  }
 }
 
 void Particles::HandleParticles(Tachyon* tachyon, State& state) {
@@ -1000,7 +1000,7 @@ void PlayerAnimation::Update(Tachyon* tachyon, State& state) {
   {
     auto& swing_animation = animations.player_swing_wand;
     float frame_duration = 0.15f;
-    float animation_duration = frame_duration * float(swing_animation.frames.size());
+    float animation_duration = frame_duration * float(swing_animation.total_frames);
 
     if (
       state.last_wand_swing_time != 0.f &&
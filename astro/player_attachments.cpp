@@ -353,7 +353,7 @@ void PlayerAttachments::Update(Tachyon* tachyon, State& state) {
       }
     } else if (rig.current_animation == &state.animations.player_climb_up_jump) {
       float t = rig.current_animation_time;
-      float max_time = (float) rig.current_animation->frames.size();
+      float max_time = (float) rig.current_animation->total_frames;
       float alpha = t / max_time;
       float sample = SampleCurve(climb_up_jump_curve, alpha);
 
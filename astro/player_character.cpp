@@ -378,7 +378,7 @@ static void HandleHoodFlop(State& state, tSkinnedMesh& hood) {
     // Special case for the climb-up-jump animation,
     // which features very specific jump timing
     float t = rig.current_animation_time;
-    float max_time = (float) rig.current_animation->frames.size();
+    float max_time = (float) rig.current_animation->total_frames;
     float alpha = t / max_time;
     float sample = SampleCurve(climb_up_jump_hood_flop_curve, alpha);
 
@@ -388,7 +388,7 @@ static void HandleHoodFlop(State& state, tSkinnedMesh& hood) {
     hood.flop_offset = flop;
   } else if (rig.current_animation == &animations.player_small_hop) {
     float t = rig.current_animation_time;
-    float max_time = (float) rig.current_animation->frames.size();
+    float max_time = (float) rig.current_animation->total_frames;
     float alpha = t / max_time;
     float sample = SampleCurveForward(small_hop_hood_flop_curve, alpha);
 
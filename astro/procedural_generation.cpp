@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <iterator>
+#include <thread>
 
 #include "astro/procedural_generation.h"
 #include "astro/astrolabe.h"
@@ -125,6 +128,140 @@ static void UpdateBloomingFlower(tObject& flower, const tVec3f& blossom_color, c
   flower.color = color;
 }
 
+static inline void HashBytes(uint32& hash, const void* data, const size_t size) {
+  auto* bytes = (const uint8*)data;
+
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619;
+  }
+}
+
+/**
+ * ----------------------------
+ * Background rebuilds
+ * ----------------------------
+ */
+
+/**
+ * Everything the expensive generation steps read. This is copied
+ * from the live state when a rebuild starts, so the rebuild worker
+ * never touches State or any object group.
+ */
+struct ProceduralRebuildInputs {
+  std::vector<Plane> flat_ground_planes;
+  std::vector<tObject> ground_1_objects;
+  std::vector<Plane> ground_1_planes;
+  std::vector<Plane> dirt_path_planes;
+  std::vector<Plane> stone_path_planes;
+  std::vector<Plane> altar_planes;
+  std::vector<Plane> wind_chime_planes;
+  std::vector<Plane> normal_switch_planes;
+  std::vector<Plane> castle_stairs_planes;
+  std::vector<PathSegment> dirt_path_segments;
+  std::vector<PathSegment> stone_path_segments;
+};
+
+/**
+ * Staging buffers generated by the rebuild worker. These are
+ * published to the live state and object groups all at once,
+ * on the main thread, between frames.
+ */
+struct ProceduralRebuildOutputs {
+  std::vector<GroundPlantCluster> ground_plant_clusters;
+  std::vector<GrassChunk> grass_chunks;
+  std::vector<tVec3f> ground_flower_positions;
+  std::vector<tVec3f> tiny_ground_flower_positions;
+  // Hash of the generated data, for checking that rebuilds are deterministic
+  uint32 hash = 0;
+};
+
+struct astro::ProceduralRebuild {
+  ProceduralRebuildInputs inputs;
+  ProceduralRebuildOutputs outputs;
+  // The path generation the inputs were copied at
+  uint32 path_generation = 0;
+  uint32 total_steps = 0;
+  std::atomic<uint32> completed_steps = 0;
+  std::atomic<bool> is_cancelled = false;
+  std::atomic<bool> is_done = false;
+  // Generates every tile on the calling thread, for determinism checks
+  bool is_serial = false;
+  std::thread worker;
+};
+
+// Ground flower clusters generated per tile
+const static uint32 FLOWER_CLUSTERS_PER_TILE = 100;
+const static uint32 TOTAL_FLOWER_CLUSTERS = 12001;
+const static uint32 TOTAL_FLOWER_TILES = (TOTAL_FLOWER_CLUSTERS + FLOWER_CLUSTERS_PER_TILE - 1) / FLOWER_CLUSTERS_PER_TILE;
+
+/**
+ * Returns a well-mixed RNG seed for a generation tile, so each
+ * tile draws from its own stream regardless of which thread
+ * generates it, and neighboring tiles' streams are uncorrelated.
+ */
+static float GetTileSeed(const uint32 layer, const uint32 tile_index) {
+  uint32 h = (layer * 0x9E3779B9) ^ (tile_index * 0x85EBCA6B);
+
+  h ^= h >> 16;
+  h *= 0x7FEB352D;
+  h ^= h >> 15;
+  h *= 0x846CA68B;
+  h ^= h >> 16;
+
+  // Keep to 24 bits, so the seed is exactly representable as a float
+  return float(h & 0xFFFFFF);
+}
+
+/**
+ * Runs a job once per tile on the job system. Background rebuilds
+ * share the job workers with the main thread, and batches take
+ * turns, so tiles are submitted one per worker at a time. That way
+ * the main thread's per-frame batches only ever wait on a handful
+ * of tiles. Tiles must only write to their own outputs.
+ */
+static void ForEachTile(ProceduralRebuild& rebuild, const uint32 total_tiles, const std::function<void(uint32)>& job) {
+  if (rebuild.is_serial) {
+    for (uint32 tile_index = 0; tile_index < total_tiles; tile_index++) {
+      job(tile_index);
+    }
+
+    return;
+  }
+
+  uint32 batch_size = Tachyon_GetTotalJobWorkers();
+
+  for (uint32 batch_start = 0; batch_start < total_tiles; batch_start += batch_size) {
+    if (rebuild.is_cancelled) return;
+
+    uint32 batch_end = std::min(batch_start + batch_size, total_tiles);
+
+    parallel_for(batch_end - batch_start, [&](uint32 i) {
+      job(batch_start + i);
+
+      rebuild.completed_steps++;
+    });
+  }
+}
+
+/**
+ * Moves per-tile outputs into a single list, in tile order.
+ */
+template<typename T>
+static void MergeTiles(std::vector<std::vector<T>>& tiles, std::vector<T>& output) {
+  size_t total = 0;
+
+  for (auto& tile : tiles) {
+    total += tile.size();
+  }
+
+  output.reserve(output.size() + total);
+
+  for (auto& tile : tiles) {
+    std::move(tile.begin(), tile.end(), std::back_inserter(output));
+  }
+}
+
 /* ---------------------------- */
 
 /**
@@ -132,28 +269,22 @@ static void UpdateBloomingFlower(tObject& flower, const tVec3f& blossom_color, c
  * ground_1 plants
  * ----------------------------
  */
-static void GenerateGround1Plants(Tachyon* tachyon, State& state) {
+static void GenerateGround1Plants(ProceduralRebuild& rebuild) {
   log_time("GenerateGround1Plants()");
 
-  // Reset objects
-  {
-    remove_all(state.meshes.grass);
-    remove_all(state.meshes.ground_1_flower);
-  }
+  auto& ground_1_objects = rebuild.inputs.ground_1_objects;
+  uint32 total_tiles = (uint32)ground_1_objects.size();
 
-  // Reset clusters
-  {
-    for (auto& cluster : state.ground_plant_clusters) {
-      cluster.grass_positions.clear();
-      cluster.flower_positions.clear();
-    }
+  // One tile per ground_1 object
+  // @allocation
+  std::vector<std::vector<GroundPlantCluster>> tiles(total_tiles);
 
-    state.ground_plant_clusters.clear();
-  }
+  ForEachTile(rebuild, total_tiles, [&](uint32 tile_index) {
+    auto& ground = ground_1_objects[tile_index];
 
-  // Create new clusters
-  for (auto& ground : objects(state.meshes.ground_1)) {
-    if (ground.position.y < -2500.f) continue;
+    if (ground.position.y < -2500.f) return;
+
+    tRNG rng(GetTileSeed(1, tile_index));
 
     auto bounds = GetObjectBounds2D(ground, 0.8f);
     tVec3f direction = ground.rotation.getDirection();
@@ -165,8 +296,8 @@ static void GenerateGround1Plants(Tachyon* tachyon, State& state) {
     // Generate grass pieces
     for (uint16 i = 0; i < 50; i++) {
       // @todo factor
-      float x = Tachyon_GetRandom(bounds.x[0], bounds.x[1]);
-      float z = Tachyon_GetRandom(bounds.z[0], bounds.z[1]);
+      float x = rng.Random(bounds.x[0], bounds.x[1]);
+      float z = rng.Random(bounds.z[0], bounds.z[1]);
 
       float lx = x - ground.position.x;
       float lz = z - ground.position.z;
@@ -188,8 +319,8 @@ static void GenerateGround1Plants(Tachyon* tachyon, State& state) {
     // Generate flowers
     for (uint16 i = 0; i < 5; i++) {
       // @todo factor
-      float x = Tachyon_GetRandom(bounds.x[0], bounds.x[1]);
-      float z = Tachyon_GetRandom(bounds.z[0], bounds.z[1]);
+      float x = rng.Random(bounds.x[0], bounds.x[1]);
+      float z = rng.Random(bounds.z[0], bounds.z[1]);
 
       float lx = x - ground.position.x;
       float lz = z - ground.position.z;
@@ -209,15 +340,10 @@ static void GenerateGround1Plants(Tachyon* tachyon, State& state) {
     }
 
     // Save the cluster
-    state.ground_plant_clusters.push_back(cluster);
-  }
-
-  // @todo dev mode only
-  {
-    std::string message = "Generated " + std::to_string(state.ground_plant_clusters.size()) + " grass clusters";
+    tiles[tile_index].push_back(cluster);
+  });
 
-    console_log(message);
-  }
+  MergeTiles(tiles, rebuild.outputs.ground_plant_clusters);
 }
 
 static void RemoveGroundPlantClusterObjects(Tachyon* tachyon, State& state, GroundPlantCluster& cluster) {
@@ -389,72 +515,58 @@ static void UpdateGround1Plants(Tachyon* tachyon, State& state) {
  * Small grass
  * ----------------------------
  */
-static void GenerateSmallGrass(Tachyon* tachyon, State& state) {
+const static float GRASS_CHUNK_SIZE = 20000.f;
+const static int32 GRASS_CHUNKS_PER_AXIS = 41;
+const static int32 GRASS_CHUNK_GRID_OFFSET = 20;
+const static int32 MAX_BLADES_PER_GRASS_CHUNK = 4500;
+// How many grid cells around the camera's ground focus are tested for visibility
+const static int32 GRASS_CHUNK_RING_RADIUS = 2;
+
+static void GenerateSmallGrass(ProceduralRebuild& rebuild) {
   log_time("GenerateSmallGrass()");
 
-  auto& meshes = state.meshes;
+  auto& inputs = rebuild.inputs;
 
-  const float chunk_width = 20000.f;
-  const float chunk_height = 20000.f;
+  const float chunk_width = GRASS_CHUNK_SIZE;
+  const float chunk_height = GRASS_CHUNK_SIZE;
+  const int32 chunks_per_axis = GRASS_CHUNKS_PER_AXIS;
+  const uint32 total_tiles = chunks_per_axis * chunks_per_axis;
 
+  // One tile per potential small grass chunk
   // @allocation
-  auto ground_1_planes = GetObjectPlanes(tachyon, meshes.ground_1, tVec3f(0.9f));
-  auto altar_planes = GetEntityPlanes(state.altars, tVec3f(1.9f, 1.f, 0.6f));
-  auto wind_chime_planes = GetEntityPlanes(state.wind_chimes, tVec3f(0.8f, 1.f, 1.4f));
-  auto normal_switch_planes = GetEntityPlanes(state.normal_switches, tVec3f(1.15f));
-  auto castle_stairs_planes = GetSpecialEntityPlanes(state.castle_stairs);
-
-  // Reset grass objects/chunks etc.
-  {
-    remove_all(meshes.small_grass);
+  std::vector<std::vector<GrassChunk>> tiles(total_tiles);
 
-    for (auto& chunk : state.grass_chunks) {
-      chunk.grass_blades.clear();
-    }
+  ForEachTile(rebuild, total_tiles, [&](uint32 tile_index) {
+    int32 x = int32(tile_index / chunks_per_axis) - GRASS_CHUNK_GRID_OFFSET;
+    int32 z = int32(tile_index % chunks_per_axis) - GRASS_CHUNK_GRID_OFFSET;
 
-    state.grass_chunks.clear();
-  }
-
-  // Generate small grass chunks
-  for (int32 x = -20; x <= 20; x++) {
-    for (int32 z = -20; z <= 20; z++) {
-      tVec3f center_position = tVec3f(x * chunk_width, 0.f, z * chunk_height);
-      tVec3f upper_left_corner = center_position + tVec3f(-chunk_width * 0.5f, 0, -chunk_height * 0.5f);
-      tVec3f upper_right_corner = center_position + tVec3f(chunk_width * 0.5f, 0, -chunk_height * 0.5f);
-      tVec3f lower_left_corner = center_position + tVec3f(-chunk_width * 0.5f, 0, chunk_height * 0.5f);
-      tVec3f lower_right_corner = center_position + tVec3f(chunk_width * 0.5f, 0, chunk_height * 0.5f);
-
-      if (
-        !IsPointOnAnyPlane(center_position, state.flat_ground_planes) &&
-        !IsPointOnAnyPlane(upper_left_corner, state.flat_ground_planes) &&
-        !IsPointOnAnyPlane(upper_right_corner, state.flat_ground_planes) &&
-        !IsPointOnAnyPlane(lower_left_corner, state.flat_ground_planes) &&
-        !IsPointOnAnyPlane(lower_right_corner, state.flat_ground_planes)
-      ) {
-        continue;
-      }
+    tRNG rng(GetTileSeed(2, tile_index));
 
-      GrassChunk chunk;
-      chunk.center_position = center_position;
+    tVec3f center_position = tVec3f(x * chunk_width, 0.f, z * chunk_height);
+    tVec3f upper_left_corner = center_position + tVec3f(-chunk_width * 0.5f, 0, -chunk_height * 0.5f);
+    tVec3f upper_right_corner = center_position + tVec3f(chunk_width * 0.5f, 0, -chunk_height * 0.5f);
+    tVec3f lower_left_corner = center_position + tVec3f(-chunk_width * 0.5f, 0, chunk_height * 0.5f);
+    tVec3f lower_right_corner = center_position + tVec3f(chunk_width * 0.5f, 0, chunk_height * 0.5f);
 
-      state.grass_chunks.push_back(chunk);
+    if (
+      !IsPointOnAnyPlane(center_position, inputs.flat_ground_planes) &&
+      !IsPointOnAnyPlane(upper_left_corner, inputs.flat_ground_planes) &&
+      !IsPointOnAnyPlane(upper_right_corner, inputs.flat_ground_planes) &&
+      !IsPointOnAnyPlane(lower_left_corner, inputs.flat_ground_planes) &&
+      !IsPointOnAnyPlane(lower_right_corner, inputs.flat_ground_planes)
+    ) {
+      return;
     }
-  }
 
-  for_range(0, int(state.grass_chunks.size() - 1)) {
-    auto& chunk = state.grass_chunks[i];
-
-    tVec3f upper_left_corner = chunk.center_position + tVec3f(-chunk_width * 0.5f, 0, -chunk_height * 0.5f);
-    tVec3f upper_right_corner = chunk.center_position + tVec3f(chunk_width * 0.5f, 0, -chunk_height * 0.5f);
-    tVec3f lower_left_corner = chunk.center_position + tVec3f(-chunk_width * 0.5f, 0, chunk_height * 0.5f);
-    tVec3f lower_right_corner = chunk.center_position + tVec3f(chunk_width * 0.5f, 0, chunk_height * 0.5f);
+    GrassChunk chunk;
+    chunk.center_position = center_position;
 
     // @allocation
     std::vector<Plane> local_ground_1_planes;
     std::vector<PathSegment> local_dirt_path_segments;
     std::vector<PathSegment> local_stone_path_segments;
 
-    for (auto& plane : ground_1_planes) {
+    for (auto& plane : inputs.ground_1_planes) {
       float distance = tVec3f::distance(plane.p1, chunk.center_position);
 
       if (distance < chunk_width * 1.2f) {
@@ -463,9 +575,7 @@ static void GenerateSmallGrass(Tachyon* tachyon, State& state) {
     }
 
     // @todo factor
-    for (auto& segment : state.dirt_path_segments) {
-      float distance = tVec3f::distance(segment.base_position, chunk.center_position);
-
+    for (auto& segment : inputs.dirt_path_segments) {
       if (abs(segment.base_position.x - chunk.center_position.x) > chunk_width) continue;
       if (abs(segment.base_position.z - chunk.center_position.z) > chunk_height) continue;
 
@@ -473,33 +583,33 @@ static void GenerateSmallGrass(Tachyon* tachyon, State& state) {
     }
 
     // @todo factor
-    for (auto& segment : state.stone_path_segments) {
-      float distance = tVec3f::distance(segment.base_position, chunk.center_position);
-
+    for (auto& segment : inputs.stone_path_segments) {
       if (abs(segment.base_position.x - chunk.center_position.x) > chunk_width) continue;
       if (abs(segment.base_position.z - chunk.center_position.z) > chunk_height) continue;
 
       local_stone_path_segments.push_back(segment);
     }
 
-    chunk.grass_blades.reserve(4500);
+    chunk.grass_blades.reserve(MAX_BLADES_PER_GRASS_CHUNK);
+    chunk.min_y = FLT_MAX;
+    chunk.max_y = -FLT_MAX;
 
-    for (int32 i = 0; i < 4500; i++) {
+    for (int32 i = 0; i < MAX_BLADES_PER_GRASS_CHUNK; i++) {
       tVec3f position;
-      position.x = Tachyon_GetRandom(upper_left_corner.x, upper_right_corner.x);
-      position.z = Tachyon_GetRandom(upper_left_corner.z, lower_left_corner.z);
-      position.y = CollisionSystem::QueryGroundHeight(state, position.x, position.z);
+      position.x = rng.Random(upper_left_corner.x, upper_right_corner.x);
+      position.z = rng.Random(upper_left_corner.z, lower_left_corner.z);
+      position.y = CollisionSystem::QueryGroundHeight(inputs.flat_ground_planes, position.x, position.z);
 
       if (position.y < -1500.f) continue;
       if (IsPointOnAnyPlane(position, local_ground_1_planes)) continue;
-      if (IsPointOnAnyPlane(position, altar_planes)) continue;
-      if (IsPointOnAnyPlane(position, wind_chime_planes)) continue;
-      if (IsPointOnAnyPlane(position, normal_switch_planes)) continue;
-      if (IsPointOnAnyPlane(position, castle_stairs_planes)) continue;
+      if (IsPointOnAnyPlane(position, inputs.altar_planes)) continue;
+      if (IsPointOnAnyPlane(position, inputs.wind_chime_planes)) continue;
+      if (IsPointOnAnyPlane(position, inputs.normal_switch_planes)) continue;
+      if (IsPointOnAnyPlane(position, inputs.castle_stairs_planes)) continue;
 
       GrassBlade blade;
       blade.position = position;
-      blade.scale = tVec3f(Tachyon_GetRandom(500.f, 1500.f));
+      blade.scale = tVec3f(rng.Random(500.f, 1500.f));
       blade.scale.x *= 1.2f;
       blade.scale.z *= 1.2f;
       blade.scale.y *= 0.75f;
@@ -561,56 +671,193 @@ static void GenerateSmallGrass(Tachyon* tachyon, State& state) {
       }
 
       chunk.grass_blades.push_back(blade);
+
+      chunk.min_y = std::min(chunk.min_y, position.y);
+      chunk.max_y = std::max(chunk.max_y, position.y + blade.scale.y);
+    }
+
+    tiles[tile_index].push_back(chunk);
+  });
+
+  MergeTiles(tiles, rebuild.outputs.grass_chunks);
+}
+
+static Quaternion GetSmallGrassRotation(const tVec3f& position, const float astro_time) {
+  const static float growth_rate = 0.7f;
+
+  float alpha = astro_time + position.x + position.z;
+  int iteration = (int)abs(growth_rate * alpha / t_TAU - 0.8f);
+  float rotation_angle = float(iteration) * 1.3f;
+
+  // @todo cache this
+  return Quaternion::fromAxisAngle(tVec3f(0, 1.f, 0), rotation_angle);
+}
+
+static bool IsGrassBladeCoveredByPath(State& state, const GrassBlade& blade) {
+  // Blades may briefly refer to stale path segments
+  // while a background rebuild is pending
+  if (blade.dirt_path_segment_index > -1 && blade.dirt_path_segment_index < (int32)state.dirt_path_segments.size()) {
+    auto& segment = state.dirt_path_segments[blade.dirt_path_segment_index];
+
+    if (CollisionSystem::IsPointOnPlane(blade.position, segment.visible_plane)) {
+      return true;
     }
   }
 
-  // Count total blades
-  int32 total_blades = 0;
+  if (blade.stone_path_segment_index > -1 && blade.stone_path_segment_index < (int32)state.stone_path_segments.size()) {
+    auto& segment = state.stone_path_segments[blade.stone_path_segment_index];
 
-  for (size_t i = 0; i < state.grass_chunks.size(); i++) {
-    total_blades += state.grass_chunks[i].grass_blades.size();
+    if (CollisionSystem::IsPointOnPlane(blade.position, segment.visible_plane)) {
+      return true;
+    }
   }
 
-  // @todo dev mode only
-  {
-    std::string message = "Generated " + std::to_string(state.grass_chunks.size()) + " grass chunks (" + std::to_string(total_blades) + " blades)";
+  return false;
+}
 
-    console_log(message);
+/**
+ * Tests a chunk's bounding box against the camera frustum,
+ * in clip space. The chunk is only culled when all of its
+ * corners are outside of the same frustum plane.
+ */
+static bool IsGrassChunkInFrustum(const GrassChunk& chunk, const tMat4f& view_projection) {
+  const float half_size = GRASS_CHUNK_SIZE * 0.5f;
+  uint8 outside[6] = { 0, 0, 0, 0, 0, 0 };
+
+  for (uint8 i = 0; i < 8; i++) {
+    tVec3f corner = tVec3f(
+      chunk.center_position.x + (i & 1 ? half_size : -half_size),
+      i & 2 ? chunk.max_y : chunk.min_y,
+      chunk.center_position.z + (i & 4 ? half_size : -half_size)
+    );
+
+    tVec4f clip = view_projection * tVec4f(corner, 1.f);
+
+    if (clip.x < -clip.w) outside[0]++;
+    if (clip.x > clip.w) outside[1]++;
+    if (clip.y < -clip.w) outside[2]++;
+    if (clip.y > clip.w) outside[3]++;
+    if (clip.z < -clip.w) outside[4]++;
+    if (clip.z > clip.w) outside[5]++;
   }
+
+  for (uint8 i = 0; i < 6; i++) {
+    if (outside[i] == 8) {
+      return false;
+    }
+  }
+
+  return true;
 }
 
-static void UpdateSmallGrassObjectByTime(tObject& grass, float astro_time) {
-  const static float growth_rate = 0.7f;
+/**
+ * Updates the objects for a resident chunk's blades in its instance
+ * range, and commits them. Blades covered by paths at the current
+ * time are hidden, as are any unused instances at the end of the range.
+ */
+static void WriteGrassChunkMatrices(Tachyon* tachyon, State& state, const GrassChunk& chunk) {
+  auto& small_grass = objects(state.meshes.small_grass);
+  uint16 start = uint16(chunk.instance_slot * MAX_BLADES_PER_GRASS_CHUNK);
+  uint32 total_blades = (uint32)chunk.grass_blades.size();
 
-  float x = grass.position.x;
-  float z = grass.position.z;
+  for (uint32 i = 0; i < total_blades; i++) {
+    auto& blade = chunk.grass_blades[i];
+    auto& object = small_grass[start + i];
 
-  float alpha = astro_time + grass.position.x + grass.position.z;
-  int iteration = (int)abs(growth_rate * alpha / t_TAU - 0.8f);
-  float rotation_angle = float(iteration) * 1.3f;
+    object.position = blade.position;
+    object.scale = IsGrassBladeCoveredByPath(state, blade) ? tVec3f(0.f) : blade.scale;
+    object.rotation = GetSmallGrassRotation(blade.position, state.astro_time);
 
-  // @todo cache this
-  grass.rotation = Quaternion::fromAxisAngle(tVec3f(0, 1.f, 0), rotation_angle);
+    commit(object);
+  }
+
+  for (uint32 i = total_blades; i < MAX_BLADES_PER_GRASS_CHUNK; i++) {
+    auto& object = small_grass[start + i];
+
+    object.position = chunk.center_position;
+    object.scale = tVec3f(0.f);
+    object.rotation = Quaternion(1.f, 0, 0, 0);
+
+    commit(object);
+  }
+}
+
+static void MakeGrassChunkResident(Tachyon* tachyon, State& state, const int32 chunk_index) {
+  auto& chunk = state.grass_chunks[chunk_index];
+  auto& small_grass = objects(state.meshes.small_grass);
+  tMaterial material = tVec4f(0.5f, 0, 0.15f, 0.8f);
+
+  chunk.instance_slot = (int32)state.resident_grass_chunks.size();
+
+  state.resident_grass_chunks.push_back(chunk_index);
+
+  // Time-invariant grass properties
+  uint16 start = uint16(chunk.instance_slot * MAX_BLADES_PER_GRASS_CHUNK);
+
+  for (size_t i = 0; i < chunk.grass_blades.size(); i++) {
+    auto& object = small_grass[start + i];
+    tColor color = chunk.grass_blades[i].color;
+    color.rgba |= 0x0002;
+
+    object.color = color;
+    object.material = material;
+  }
+
+  WriteGrassChunkMatrices(tachyon, state, chunk);
+}
+
+/**
+ * Moves the last resident chunk's instance range into the evicted
+ * chunk's range, so resident ranges stay packed at the front of
+ * the small grass group. Objects keep their ids, so each id
+ * still maps to the same index.
+ */
+static void EvictGrassChunk(Tachyon* tachyon, State& state, const int32 chunk_index) {
+  auto& chunk = state.grass_chunks[chunk_index];
+  auto& small_grass = objects(state.meshes.small_grass);
+  int32 slot = chunk.instance_slot;
+  int32 last_slot = (int32)state.resident_grass_chunks.size() - 1;
+
+  if (slot != last_slot) {
+    int32 moved_chunk_index = state.resident_grass_chunks[last_slot];
+    uint32 to = slot * MAX_BLADES_PER_GRASS_CHUNK;
+    uint32 from = last_slot * MAX_BLADES_PER_GRASS_CHUNK;
+
+    for (uint32 i = 0; i < MAX_BLADES_PER_GRASS_CHUNK; i++) {
+      auto& object = small_grass[uint16(to + i)];
+      uint16 object_id = object.object_id;
+
+      object = small_grass[uint16(from + i)];
+      object.object_id = object_id;
+    }
+
+    std::copy_n(&small_grass.matrices[from], MAX_BLADES_PER_GRASS_CHUNK, &small_grass.matrices[to]);
+    std::copy_n(&small_grass.surfaces[from], MAX_BLADES_PER_GRASS_CHUNK, &small_grass.surfaces[to]);
+
+    state.grass_chunks[moved_chunk_index].instance_slot = slot;
+    state.resident_grass_chunks[slot] = moved_chunk_index;
+  }
+
+  state.resident_grass_chunks.pop_back();
+
+  chunk.instance_slot = -1;
+  small_grass.buffered = false;
 }
 
 static void UpdateSmallGrass(Tachyon* tachyon, State& state) {
   profile("UpdateSmallGrass()");
 
   auto& meshes = state.meshes;
+  auto& record = mesh(meshes.small_grass);
+  auto& small_grass = record.group;
+  auto& camera = tachyon->scene.camera;
+  int32 max_resident_chunks = small_grass.total / MAX_BLADES_PER_GRASS_CHUNK;
 
-  auto& player_position = state.player_position;
-  bool is_astro_turning = state.astro_turn_speed != 0.f;
-  auto& small_grass = objects(meshes.small_grass);
-  uint16 object_index = 0;
-
-  #define remove_blade_if_active(blade)\
-    if (blade.active_object_id != 0xFFFF) {\
-      Tachyon_RemoveObject(tachyon, meshes.small_grass, blade.active_object_id);\
-      blade.active_object_id = 0xFFFF;\
-    }\
+  if (state.grass_chunk_grid.empty()) {
+    return;
+  }
 
   // @todo factor
-  auto& camera = tachyon->scene.camera;
   Quaternion standard_camera_rotation = Quaternion::fromAxisAngle(tVec3f(1.f, 0, 0), 0.9f);
   // @hack Invert y to get the proper direction. Probably a mistake somewhere.
   tVec3f camera_direction = standard_camera_rotation.getDirection() * tVec3f(1.f, -1.f, 1.f);
@@ -618,110 +865,87 @@ static void UpdateSmallGrass(Tachyon* tachyon, State& state) {
   // @todo clarify this and make it easier to understand
   tVec3f ground_center = camera.position + camera_direction * 10000.f * 1.2f;
 
-  for (auto& chunk : state.grass_chunks) {
-    float chunk_z_distance = ground_center.z - chunk.center_position.z;
-
-    bool is_chunk_in_view = (
-      abs(ground_center.x - chunk.center_position.x) < 30000.f && (
-        chunk_z_distance < 40000.f &&
-        chunk_z_distance > -15000.f
-      )
-    );
-
-    if (!is_chunk_in_view) {
-      if (chunk.is_currently_in_view) {
-        for (auto& blade : chunk.grass_blades) {
-          remove_blade_if_active(blade);
-        }
-      }
+  tMat4f view_projection = (
+    tMat4f::perspective(camera.fov, tachyon->scene.z_near, tachyon->scene.z_far) *
+    camera.rotation.toMatrix4f() *
+    tMat4f::translation(camera.position.invert())
+  );
 
-      chunk.is_currently_in_view = false;
+  // Find visible chunks in the grid cells around the ground center,
+  // nearest first, up to the number of available instance ranges
+  // @allocation
+  std::vector<std::pair<float, int32>> visible_chunks;
 
-      continue;
-    }
+  int32 center_x = int32(roundf(ground_center.x / GRASS_CHUNK_SIZE)) + GRASS_CHUNK_GRID_OFFSET;
+  int32 center_z = int32(roundf(ground_center.z / GRASS_CHUNK_SIZE)) + GRASS_CHUNK_GRID_OFFSET;
 
-    chunk.is_currently_in_view = true;
+  for (int32 x = center_x - GRASS_CHUNK_RING_RADIUS; x <= center_x + GRASS_CHUNK_RING_RADIUS; x++) {
+    for (int32 z = center_z - GRASS_CHUNK_RING_RADIUS; z <= center_z + GRASS_CHUNK_RING_RADIUS; z++) {
+      if (x < 0 || x >= GRASS_CHUNKS_PER_AXIS || z < 0 || z >= GRASS_CHUNKS_PER_AXIS) continue;
 
-    for (auto& blade : chunk.grass_blades) {
-      float z_distance = blade.position.z - ground_center.z;
-      float x_limit = 15000.f + -z_distance * 0.5f;
-      if (x_limit > 25000.f) x_limit = 25000.f;
-
-      // Remove out-of-view blades
-      if (
-        abs(blade.position.x - ground_center.x) > x_limit ||
-        z_distance > 8000.f ||
-        z_distance < -30000.f
-      ) {
-        remove_blade_if_active(blade);
-
-        continue;
-      }
+      int32 chunk_index = state.grass_chunk_grid[x * GRASS_CHUNKS_PER_AXIS + z];
 
-      // Remove blades covered up by path segments in the current time
-      {
-        // @todo factor
-        if (blade.dirt_path_segment_index > -1) {
-          auto& segment = state.dirt_path_segments[blade.dirt_path_segment_index];
+      if (chunk_index == -1) continue;
 
-          if (CollisionSystem::IsPointOnPlane(blade.position, segment.visible_plane)) {
-            remove_blade_if_active(blade);
+      auto& chunk = state.grass_chunks[chunk_index];
 
-            continue;
-          }
-        }
+      if (!IsGrassChunkInFrustum(chunk, view_projection)) continue;
 
-        // @todo factor
-        if (blade.stone_path_segment_index > -1) {
-          auto& segment = state.stone_path_segments[blade.stone_path_segment_index];
+      float distance = (chunk.center_position - ground_center).magnitude();
 
-          if (CollisionSystem::IsPointOnPlane(blade.position, segment.visible_plane)) {
-            remove_blade_if_active(blade);
+      visible_chunks.push_back({ distance, chunk_index });
+    }
+  }
 
-            continue;
-          }
-        }
-      }
+  std::sort(visible_chunks.begin(), visible_chunks.end());
 
-      if (blade.active_object_id != 0xFFFF) {
-        if (is_astro_turning) {
-          // Update any active blades while astro turning,
-          // since the blades need to move about in place
-          auto& grass = small_grass.getByIdFast(blade.active_object_id);
+  if ((int32)visible_chunks.size() > max_resident_chunks) {
+    visible_chunks.resize(max_resident_chunks);
+  }
 
-          // Time evolution
-          UpdateSmallGrassObjectByTime(grass, state.astro_time);
+  // Evict chunks which are no longer visible
+  for (int32 slot = (int32)state.resident_grass_chunks.size() - 1; slot >= 0; slot--) {
+    int32 chunk_index = state.resident_grass_chunks[slot];
+    bool is_visible = false;
 
-          commit(grass);
-        }
+    for (auto& [distance, visible_chunk_index] : visible_chunks) {
+      if (visible_chunk_index == chunk_index) {
+        is_visible = true;
 
-        continue;
+        break;
       }
+    }
 
-      // Create new small grass objects as the blades stream into view
-      auto& grass = create(meshes.small_grass);
-
-      // Time-invariant grass properties
-      grass.position = blade.position;
-      grass.scale = blade.scale;
-      grass.color = blade.color;
-      grass.color.rgba |= 0x0002;
-      grass.material = tVec4f(0.5f, 0, 0.15f, 0.8f);
-
-      // Time evolution
-      UpdateSmallGrassObjectByTime(grass, state.astro_time);
+    if (!is_visible) {
+      EvictGrassChunk(tachyon, state, chunk_index);
+    }
+  }
 
-      commit(grass);
+  // Update resident chunks while astro turning, since the
+  // blades need to move about in place with astro time
+  if (state.astro_turn_speed != 0.f) {
+    for (auto chunk_index : state.resident_grass_chunks) {
+      WriteGrassChunkMatrices(tachyon, state, state.grass_chunks[chunk_index]);
+    }
+  }
 
-      blade.active_object_id = grass.object_id;
+  // Stream in newly-visible chunks
+  for (auto& [distance, chunk_index] : visible_chunks) {
+    if (state.grass_chunks[chunk_index].instance_slot == -1) {
+      MakeGrassChunkResident(tachyon, state, chunk_index);
     }
   }
 
+  uint16 total_instances = uint16(state.resident_grass_chunks.size() * MAX_BLADES_PER_GRASS_CHUNK);
+
+  small_grass.total_active = total_instances;
+  record.lod_1.instance_count = total_instances;
+  record.lod_2.instance_count = 0;
+  record.lod_3.instance_count = 0;
+
   // @todo dev mode only
   if (state.show_game_stats) {
-    uint16 total_active = objects(meshes.small_grass).total_active;
-
-    add_dev_label("Total small grass: ", std::to_string(total_active));
+    add_dev_label("Resident small grass chunks: ", std::to_string(state.resident_grass_chunks.size()));
   }
 }
 
@@ -730,117 +954,97 @@ static void UpdateSmallGrass(Tachyon* tachyon, State& state) {
  * Ground flowers
  * ----------------------------
  */
-static void GenerateGroundFlowers(Tachyon* tachyon, State& state) {
+static void GenerateGroundFlowers(ProceduralRebuild& rebuild) {
   log_time("GenerateGroundFlowers()");
 
-  auto& meshes = state.meshes;
+  auto& inputs = rebuild.inputs;
+  auto& outputs = rebuild.outputs;
 
-  auto dirt_path_planes = GetObjectPlanes(tachyon, meshes.dirt_path);
-  auto stone_path_planes = GetObjectPlanes(tachyon, meshes.stone_path);
-  auto castle_stairs_planes = GetSpecialEntityPlanes(state.castle_stairs);
+  auto is_valid_flower_position = [&](const tVec3f& position) {
+    return !(
+      IsPointOnAnyPlane(position, inputs.dirt_path_planes) ||
+      IsPointOnAnyPlane(position, inputs.stone_path_planes) ||
+      IsPointOnAnyPlane(position, inputs.castle_stairs_planes) ||
+      position.y < -1500.f
+    );
+  };
 
-  // @todo factor
-  remove_all(meshes.ground_flower);
-
-  // Clusters
-  for_range(0, 12000) {
-    tRNG rng(1234.f + float(i));
-
-    tVec3f center;
-    center.x = rng.Random(-400000.f, 400000.f);
-    center.y = -1000.f;
-    center.z = rng.Random(-400000.f, 400000.f);
-
-    // 4 flowers per cluster
-    // @todo avoid crashing at the limit! right now we only avoid
-    // hitting the max because there isn't enough flat ground to
-    // spawn flowers on
-    for (int i = 0; i < 4; i++) {
-      tVec3f position;
-      position.x = center.x + rng.Random(-1500.f, 1500.f);
-      position.z = center.z + rng.Random(-1500.f, 1500.f);
-      position.y = CollisionSystem::QueryGroundHeight(state, position.x, position.z);
-
-      if (
-        IsPointOnAnyPlane(position, dirt_path_planes) ||
-        IsPointOnAnyPlane(position, stone_path_planes) ||
-        IsPointOnAnyPlane(position, castle_stairs_planes) ||
-        position.y < -1500.f
-      ) {
-        continue;
-      }
+  // Ground flower clusters
+  {
+    // @allocation
+    std::vector<std::vector<tVec3f>> tiles(TOTAL_FLOWER_TILES);
 
-      // @todo @bug create() is not technically thread-safe, which occasionally
-      // causes start-time crashes due to an incorrectly-resolved group.total_active
-      // or some related issue. This will need to be addressed.
-      auto& flower = create(meshes.ground_flower);
+    ForEachTile(rebuild, TOTAL_FLOWER_TILES, [&](uint32 tile_index) {
+      uint32 start = tile_index * FLOWER_CLUSTERS_PER_TILE;
+      uint32 end = std::min(start + FLOWER_CLUSTERS_PER_TILE, TOTAL_FLOWER_CLUSTERS);
 
-      flower.position = position;
-      flower.position.y += 600.f;
-      flower.scale = tVec3f(250.f);
-      flower.color = tVec3f(1.f, 0.1f, 0.1f);
+      for (uint32 cluster_index = start; cluster_index < end; cluster_index++) {
+        tRNG rng(1234.f + float(cluster_index));
 
-      commit(flower);
-    }
+        tVec3f center;
+        center.x = rng.Random(-400000.f, 400000.f);
+        center.y = -1000.f;
+        center.z = rng.Random(-400000.f, 400000.f);
+
+        // 4 flowers per cluster
+        // @todo avoid crashing at the limit! right now we only avoid
+        // hitting the max because there isn't enough flat ground to
+        // spawn flowers on
+        for (int i = 0; i < 4; i++) {
+          tVec3f position;
+          position.x = center.x + rng.Random(-1500.f, 1500.f);
+          position.z = center.z + rng.Random(-1500.f, 1500.f);
+          position.y = CollisionSystem::QueryGroundHeight(inputs.flat_ground_planes, position.x, position.z);
+
+          if (!is_valid_flower_position(position)) continue;
+
+          position.y += 600.f;
+
+          tiles[tile_index].push_back(position);
+        }
+      }
+    });
+
+    MergeTiles(tiles, outputs.ground_flower_positions);
   }
 
-  // @todo dev mode only
+  // Tiny ground flower clusters
   {
-    std::string message = "Generated " + std::to_string(objects(meshes.ground_flower).total_active) + " ground flower objects";
+    // @allocation
+    std::vector<std::vector<tVec3f>> tiles(TOTAL_FLOWER_TILES);
 
-    console_log(message);
-  }
+    ForEachTile(rebuild, TOTAL_FLOWER_TILES, [&](uint32 tile_index) {
+      uint32 start = tile_index * FLOWER_CLUSTERS_PER_TILE;
+      uint32 end = std::min(start + FLOWER_CLUSTERS_PER_TILE, TOTAL_FLOWER_CLUSTERS);
 
-  // @todo factor
-  remove_all(meshes.tiny_ground_flower);
-
-  // Clusters
-  for_range(0, 12000) {
-    tRNG rng(5678.f + float(i));
-
-    tVec3f center;
-    center.x = rng.Random(-400000.f, 400000.f);
-    center.y = -875.f;
-    center.z = rng.Random(-400000.f, 400000.f);
-
-    // 6 flowers per cluster
-    // @todo avoid crashing at the limit! right now we only avoid
-    // hitting the max because there isn't enough flat ground to
-    // spawn flowers on
-    for (int i = 0; i < 6; i++) {
-      tVec3f position;
-      position.x = center.x + rng.Random(-1000.f, 1000.f);
-      position.z = center.z + rng.Random(-1000.f, 1000.f);
-      position.y = CollisionSystem::QueryGroundHeight(state, position.x, position.z) + rng.Random(0.f, 100.f);
-
-      if (
-        IsPointOnAnyPlane(position, dirt_path_planes) ||
-        IsPointOnAnyPlane(position, stone_path_planes) ||
-        IsPointOnAnyPlane(position, castle_stairs_planes) ||
-        position.y < -1500.f
-      ) {
-        continue;
-      }
+      for (uint32 cluster_index = start; cluster_index < end; cluster_index++) {
+        tRNG rng(5678.f + float(cluster_index));
 
-      // @todo @bug create() is not technically thread-safe, which occasionally
-      // causes start-time crashes due to an incorrectly-resolved group.total_active
-      // or some related issue. This will need to be addressed.
-      auto& flower = create(meshes.tiny_ground_flower);
+        tVec3f center;
+        center.x = rng.Random(-400000.f, 400000.f);
+        center.y = -875.f;
+        center.z = rng.Random(-400000.f, 400000.f);
 
-      flower.position = position;
-      flower.position.y += 600.f;
-      flower.scale = tVec3f(100.f);
-      flower.color = tVec3f(1.f);
+        // 6 flowers per cluster
+        // @todo avoid crashing at the limit! right now we only avoid
+        // hitting the max because there isn't enough flat ground to
+        // spawn flowers on
+        for (int i = 0; i < 6; i++) {
+          tVec3f position;
+          position.x = center.x + rng.Random(-1000.f, 1000.f);
+          position.z = center.z + rng.Random(-1000.f, 1000.f);
+          position.y = CollisionSystem::QueryGroundHeight(inputs.flat_ground_planes, position.x, position.z) + rng.Random(0.f, 100.f);
 
-      commit(flower);
-    }
-  }
+          if (!is_valid_flower_position(position)) continue;
 
-  // @todo dev mode only
-  {
-    std::string message = "Generated " + std::to_string(objects(meshes.tiny_ground_flower).total_active) + " tiny ground flower objects";
+          position.y += 600.f;
 
-    console_log(message);
+          tiles[tile_index].push_back(position);
+        }
+      }
+    });
+
+    MergeTiles(tiles, outputs.tiny_ground_flower_positions);
   }
 }
 
@@ -868,6 +1072,13 @@ static void UpdateGroundFlowers(Tachyon* tachyon, State& state) {
   for (uint16 i = 0; i < mesh(meshes.ground_flower).lod_1.instance_count; i++) {
     auto& flower = objects(meshes.ground_flower)[i];
 
+    // Committed flower data moves along with its object when
+    // levels of detail are repartitioned, so it only needs to
+    // be recomputed when astro time changes
+    if (EvaluationCache::IsCurrent(state.ground_flower_cache, flower.object_id, state.astro_time)) continue;
+
+    EvaluationCache::Store(state.ground_flower_cache, flower.object_id, state.astro_time);
+
     float life_variation = fmodf(abs(flower.position.x + flower.position.z) * 0.1f, 10.f);
     float life_alpha = base_time_progress + life_variation;
     float incarnation_time = life_alpha / lifetime;
@@ -891,6 +1102,13 @@ static void UpdateGroundFlowers(Tachyon* tachyon, State& state) {
   for (uint16 i = 0; i < mesh(meshes.tiny_ground_flower).lod_1.instance_count; i++) {
     auto& flower = objects(meshes.tiny_ground_flower)[i];
 
+    // Committed flower data moves along with its object when
+    // levels of detail are repartitioned, so it only needs to
+    // be recomputed when astro time changes
+    if (EvaluationCache::IsCurrent(state.tiny_ground_flower_cache, flower.object_id, state.astro_time)) continue;
+
+    EvaluationCache::Store(state.tiny_ground_flower_cache, flower.object_id, state.astro_time);
+
     float life_variation = fmodf(abs(flower.position.x + flower.position.z) * 0.1f, 10.f);
     float life_alpha = base_time_progress + life_variation;
     float incarnation_time = life_alpha / tiny_lifetime;
@@ -924,6 +1142,9 @@ static void GenerateBushFlowers(Tachyon* tachyon, State& state) {
     commit(create(state.meshes.bush_flower_2));
     commit(create(state.meshes.flower_middle));
   }
+
+  // Ensure the new flowers are placed on the next update
+  state.bush_flower_inputs_hash = 0;
 }
 
 static tVec3f GetBushFlowerBlossomColor(const float astro_time) {
@@ -984,6 +1205,28 @@ static void UpdateFlowerBushes(Tachyon* tachyon, State& state) {
   auto& player_position = state.player_position;
   float base_time_progress = 0.5f * (state.astro_time - -500.f);
 
+  // Bush flowers only depend on astro time, the player's position and the
+  // bushes themselves, so reuse last frame's instances if none have changed
+  {
+    uint32 inputs_hash = 2166136261;
+
+    HashBytes(inputs_hash, &state.astro_time, sizeof(float));
+    HashBytes(inputs_hash, &state.player_position, sizeof(tVec3f));
+    HashBytes(inputs_hash, &state.is_nighttime, sizeof(bool));
+
+    for (auto& entity : state.flower_bushes) {
+      HashBytes(inputs_hash, &entity.visible_position, sizeof(tVec3f));
+      HashBytes(inputs_hash, &entity.visible_scale, sizeof(tVec3f));
+      HashBytes(inputs_hash, &entity.astro_start_time, sizeof(float));
+    }
+
+    if (inputs_hash == state.bush_flower_inputs_hash) {
+      goto after_loop;
+    }
+
+    state.bush_flower_inputs_hash = inputs_hash;
+  }
+
   reset_instances(meshes.bush_flower);
   reset_instances(meshes.bush_flower_2);
   reset_instances(meshes.flower_middle);
@@ -1441,29 +1684,297 @@ static void UpdateStonePaths(Tachyon* tachyon, State& state) {
 
 /* ---------------------------- */
 
+static ProceduralRebuild* CreateProceduralRebuild(Tachyon* tachyon, State& state) {
+  auto& meshes = state.meshes;
+  auto& ground_1 = objects(meshes.ground_1);
+  auto* rebuild = new ProceduralRebuild;
+  auto& inputs = rebuild->inputs;
+
+  inputs.flat_ground_planes = state.flat_ground_planes;
+  inputs.ground_1_objects.assign(ground_1.begin(), ground_1.end());
+  inputs.ground_1_planes = GetObjectPlanes(tachyon, meshes.ground_1, tVec3f(0.9f));
+  inputs.dirt_path_planes = GetObjectPlanes(tachyon, meshes.dirt_path);
+  inputs.stone_path_planes = GetObjectPlanes(tachyon, meshes.stone_path);
+  inputs.altar_planes = GetEntityPlanes(state.altars, tVec3f(1.9f, 1.f, 0.6f));
+  inputs.wind_chime_planes = GetEntityPlanes(state.wind_chimes, tVec3f(0.8f, 1.f, 1.4f));
+  inputs.normal_switch_planes = GetEntityPlanes(state.normal_switches, tVec3f(1.15f));
+  inputs.castle_stairs_planes = GetSpecialEntityPlanes(state.castle_stairs);
+  inputs.dirt_path_segments = state.dirt_path_segments;
+  inputs.stone_path_segments = state.stone_path_segments;
+
+  rebuild->path_generation = state.path_generation;
+
+  // ground_1 object tiles, small grass chunk tiles, and ground flower tiles
+  rebuild->total_steps = (uint32)inputs.ground_1_objects.size() + GRASS_CHUNKS_PER_AXIS * GRASS_CHUNKS_PER_AXIS + 2 * TOTAL_FLOWER_TILES;
+
+  return rebuild;
+}
+
+/**
+ * FNV-1a hash over everything a rebuild generates. Generation is
+ * tiled and seeded per tile, so this should be identical across
+ * runs and thread counts, given the same level data.
+ */
+static uint32 HashProceduralOutputs(const ProceduralRebuildOutputs& outputs) {
+  uint32 hash = 2166136261;
+
+  for (auto& cluster : outputs.ground_plant_clusters) {
+    HashBytes(hash, cluster.grass_positions.data(), cluster.grass_positions.size() * sizeof(tVec3f));
+    HashBytes(hash, cluster.flower_positions.data(), cluster.flower_positions.size() * sizeof(tVec3f));
+  }
+
+  for (auto& chunk : outputs.grass_chunks) {
+    for (auto& blade : chunk.grass_blades) {
+      HashBytes(hash, &blade.position, sizeof(tVec3f));
+      HashBytes(hash, &blade.scale, sizeof(tVec3f));
+      HashBytes(hash, &blade.color.rgba, sizeof(uint16));
+      HashBytes(hash, &blade.dirt_path_segment_index, sizeof(int32));
+      HashBytes(hash, &blade.stone_path_segment_index, sizeof(int32));
+    }
+  }
+
+  HashBytes(hash, outputs.ground_flower_positions.data(), outputs.ground_flower_positions.size() * sizeof(tVec3f));
+  HashBytes(hash, outputs.tiny_ground_flower_positions.data(), outputs.tiny_ground_flower_positions.size() * sizeof(tVec3f));
+
+  return hash;
+}
+
+/**
+ * Runs on the rebuild worker. Only reads the rebuild's inputs,
+ * and only writes to its outputs.
+ */
+static void GenerateProceduralObjects(ProceduralRebuild& rebuild) {
+  GenerateGround1Plants(rebuild);
+  GenerateSmallGrass(rebuild);
+  GenerateGroundFlowers(rebuild);
+
+  rebuild.outputs.hash = HashProceduralOutputs(rebuild.outputs);
+  rebuild.is_done = true;
+}
+
+/**
+ * Generates the rebuild's tiles again on a single thread, and stops
+ * if the output differs from the multithreaded output. Tiles are
+ * seeded independently of the thread running them, so a mismatch
+ * means some tile is touching data it doesn't own.
+ */
+static void CheckProceduralDeterminism(Tachyon* tachyon, State& state, const ProceduralRebuildOutputs& outputs) {
+  auto* serial_rebuild = CreateProceduralRebuild(tachyon, state);
+
+  serial_rebuild->is_serial = true;
+
+  GenerateProceduralObjects(*serial_rebuild);
+
+  uint32 serial_hash = serial_rebuild->outputs.hash;
+
+  delete serial_rebuild;
+
+  if (serial_hash != outputs.hash) {
+    printf("[CheckProceduralDeterminism] Fatal Error: Multithreaded output hash %u does not match single-threaded hash %u\n", outputs.hash, serial_hash);
+
+    throw new std::exception("Error");
+    exit(0);
+  }
+}
+
+/**
+ * Swaps a finished rebuild's staging buffers into the live state,
+ * and recreates the objects which are not managed per-frame.
+ */
+static void PublishProceduralRebuild(Tachyon* tachyon, State& state, ProceduralRebuildOutputs& outputs) {
+  log_time("PublishProceduralRebuild()");
+
+  auto& meshes = state.meshes;
+
+  // ground_1 plants
+  {
+    remove_all(meshes.grass);
+    remove_all(meshes.ground_1_flower);
+
+    state.ground_plant_clusters = std::move(outputs.ground_plant_clusters);
+  }
+
+  // Small grass
+  {
+    remove_all(meshes.small_grass);
+
+    // Create every small grass object up front, so each instance
+    // range has objects with consistent id -> index mappings.
+    // UpdateSmallGrass only draws the ranges in use.
+    for (uint16 i = 0; i < objects(meshes.small_grass).total; i++) {
+      create(meshes.small_grass);
+    }
+
+    state.grass_chunks = std::move(outputs.grass_chunks);
+    state.resident_grass_chunks.clear();
+    state.grass_chunk_grid.assign(GRASS_CHUNKS_PER_AXIS * GRASS_CHUNKS_PER_AXIS, -1);
+
+    for (int32 i = 0; i < (int32)state.grass_chunks.size(); i++) {
+      auto& center = state.grass_chunks[i].center_position;
+      int32 x = int32(roundf(center.x / GRASS_CHUNK_SIZE)) + GRASS_CHUNK_GRID_OFFSET;
+      int32 z = int32(roundf(center.z / GRASS_CHUNK_SIZE)) + GRASS_CHUNK_GRID_OFFSET;
+
+      state.grass_chunk_grid[x * GRASS_CHUNKS_PER_AXIS + z] = i;
+    }
+  }
+
+  // Ground flowers
+  {
+    remove_all(meshes.ground_flower);
+    remove_all(meshes.tiny_ground_flower);
+
+    EvaluationCache::Reset(state.ground_flower_cache);
+    EvaluationCache::Reset(state.tiny_ground_flower_cache);
+
+    for (auto& position : outputs.ground_flower_positions) {
+      auto& flower = create(meshes.ground_flower);
+
+      flower.position = position;
+      flower.scale = tVec3f(250.f);
+      flower.color = tVec3f(1.f, 0.1f, 0.1f);
+
+      commit(flower);
+    }
+
+    for (auto& position : outputs.tiny_ground_flower_positions) {
+      auto& flower = create(meshes.tiny_ground_flower);
+
+      flower.position = position;
+      flower.scale = tVec3f(100.f);
+      flower.color = tVec3f(1.f);
+
+      commit(flower);
+    }
+  }
+
+  state.is_rebuilding_procedural_objects = false;
+
+  // @todo dev mode only
+  {
+    int32 total_blades = 0;
+
+    for (auto& chunk : state.grass_chunks) {
+      total_blades += chunk.grass_blades.size();
+    }
+
+    console_log("Generated " + std::to_string(state.ground_plant_clusters.size()) + " grass clusters");
+    console_log("Generated " + std::to_string(state.grass_chunks.size()) + " grass chunks (" + std::to_string(total_blades) + " blades)");
+    console_log("Generated " + std::to_string(objects(meshes.ground_flower).total_active) + " ground flower objects");
+    console_log("Generated " + std::to_string(objects(meshes.tiny_ground_flower).total_active) + " tiny ground flower objects");
+    console_log("Procedural output hash: " + std::to_string(outputs.hash));
+  }
+}
+
+/**
+ * Starts generating a rebuild from the current level data on
+ * its own worker thread. The worker only touches the rebuild.
+ */
+static void LaunchProceduralRebuild(Tachyon* tachyon, State& state) {
+  auto* rebuild = CreateProceduralRebuild(tachyon, state);
+
+  rebuild->worker = std::thread([rebuild]() {
+    GenerateProceduralObjects(*rebuild);
+  });
+
+  state.procedural_rebuild = rebuild;
+  state.is_rebuilding_procedural_objects = true;
+}
+
+/**
+ * Publishes the current background rebuild once it has finished.
+ * Called at the start of the procedural update, so the live data
+ * only ever changes between frames.
+ */
+static void HandleProceduralRebuild(Tachyon* tachyon, State& state) {
+  auto* rebuild = state.procedural_rebuild;
+
+  if (rebuild == nullptr) {
+    return;
+  }
+
+  if (rebuild->path_generation != state.path_generation) {
+    // The paths were regenerated after the rebuild started, so the
+    // path segment indexes it generates would no longer line up
+    ProceduralBehavior::Generation::CancelProceduralRebuild(state);
+
+    LaunchProceduralRebuild(tachyon, state);
+  } else if (rebuild->is_done) {
+    rebuild->worker.join();
+
+    PublishProceduralRebuild(tachyon, state, rebuild->outputs);
+
+    delete rebuild;
+
+    state.procedural_rebuild = nullptr;
+  } else if (state.show_game_stats) {
+    int32 percent = int32(ProceduralBehavior::Generation::GetProceduralRebuildProgress(state) * 100.f);
+
+    add_dev_label("Rebuilding procedural objects", std::to_string(percent) + "%");
+  }
+}
+
+/* ---------------------------- */
+
 void ProceduralBehavior::Generation::RebuildSimpleProceduralObjects(Tachyon* tachyon, State& state) {
   GenerateDirtPaths(tachyon, state);
   GenerateStonePaths(tachyon, state);
   GenerateBushFlowers(tachyon, state);
   GenerateWaterFlows(tachyon, state);
+
+  state.path_generation++;
 }
 
 void ProceduralBehavior::Generation::RebuildAllProceduralObjects(Tachyon* tachyon, State& state) {
+  CancelProceduralRebuild(state);
   RebuildSimpleProceduralObjects(tachyon, state);
 
-  GenerateGround1Plants(tachyon, state);
-  GenerateSmallGrass(tachyon, state);
-  GenerateGroundFlowers(tachyon, state);
+  auto* rebuild = CreateProceduralRebuild(tachyon, state);
+
+  GenerateProceduralObjects(*rebuild);
+  CheckProceduralDeterminism(tachyon, state, rebuild->outputs);
+  PublishProceduralRebuild(tachyon, state, rebuild->outputs);
+
+  delete rebuild;
+}
+
+void ProceduralBehavior::Generation::StartProceduralRebuild(Tachyon* tachyon, State& state) {
+  CancelProceduralRebuild(state);
+  RebuildSimpleProceduralObjects(tachyon, state);
+
+  LaunchProceduralRebuild(tachyon, state);
+}
+
+void ProceduralBehavior::Generation::CancelProceduralRebuild(State& state) {
+  auto* rebuild = state.procedural_rebuild;
+
+  if (rebuild != nullptr) {
+    // Workers check for cancellation between tiles,
+    // so this only waits for the tiles in progress
+    rebuild->is_cancelled = true;
+    rebuild->worker.join();
+
+    delete rebuild;
+
+    state.procedural_rebuild = nullptr;
+  }
 
   state.is_rebuilding_procedural_objects = false;
 }
 
+float ProceduralBehavior::Generation::GetProceduralRebuildProgress(State& state) {
+  auto* rebuild = state.procedural_rebuild;
+
+  if (rebuild == nullptr || rebuild->total_steps == 0) {
+    return 1.f;
+  }
+
+  return float(rebuild->completed_steps) / float(rebuild->total_steps);
+}
+
 void ProceduralBehavior::Generation::UpdateProceduralObjects(Tachyon* tachyon, State& state) {
   profile("UpdateProceduralObjects()");
 
-  if (state.is_rebuilding_procedural_objects) {
-    return;
-  }
+  HandleProceduralRebuild(tachyon, state);
 
   UpdateDirtPaths(tachyon, state);
   UpdateStonePaths(tachyon, state);
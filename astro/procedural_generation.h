@@ -8,6 +8,9 @@ namespace astro {
     namespace Generation {
       void RebuildSimpleProceduralObjects(Tachyon* tachyon, State& state);
       void RebuildAllProceduralObjects(Tachyon* tachyon, State& state);
+      void StartProceduralRebuild(Tachyon* tachyon, State& state);
+      void CancelProceduralRebuild(State& state);
+      float GetProceduralRebuildProgress(State& state);
       void UpdateProceduralObjects(Tachyon* tachyon, State& state);
     }
   }
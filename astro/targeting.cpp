@@ -5,18 +5,9 @@
 using namespace astro;
 
 const static float target_distance_limit = 10000.f;
-
-static int32 FindRecordIndex(std::vector<EntityRecord>& records, EntityRecord& record) {
-  for (size_t i = 0; i < records.size(); i++) {
-    auto& compared = records[i];
-
-    if (IsSameEntity(record, compared)) {
-      return (int32)i;
-    }
-  }
-
-  return -1;
-}
+// Well below the targeting range, so range queries
+// only visit cells which mostly overlap it
+const static float targetable_cell_size = target_distance_limit / 4.f;
 
 static inline void ResetEntityRecord(EntityRecord& record) {
   record.type = UNSPECIFIED;
@@ -29,15 +20,16 @@ static EntityRecord GetIdealNonSelectedTarget(State& state) {
   float closest_dot = -1.f;
   EntityRecord candidate;
 
-  for (auto& record : state.targetable_entities) {
+  for (size_t i = 0; i < state.targetable_entities.size(); i++) {
+    auto& record = state.targetable_entities[i];
+
     if (IsSameEntity(record, state.target_entity)) {
       continue;
     }
 
-    auto& entity = *EntityManager::FindEntity(state, record);
-    tVec3f entity_direction = (entity.visible_position - state.player_position).unit();
+    tVec3f entity_direction = (state.targetable_positions[i] - state.player_position).unit();
     float dot = tVec3f::dot(state.player_facing_direction, entity_direction);
-    // float distance = tVec3f::distance(state.player_position, entity.visible_position);
+    // float distance = tVec3f::distance(state.player_position, state.targetable_positions[i]);
 
     if (dot > closest_dot) {
       closest_dot = dot;
@@ -52,13 +44,14 @@ static EntityRecord GetLeftmostNonSelectedTarget(State& state) {
   float leftmost_x = FLT_MAX;
   EntityRecord candidate;
 
-  for (auto& record : state.targetable_entities) {
+  for (size_t i = 0; i < state.targetable_entities.size(); i++) {
+    auto& record = state.targetable_entities[i];
+
     if (IsSameEntity(record, state.target_entity)) {
       continue;
     }
 
-    auto& entity = *EntityManager::FindEntity(state, record);
-    float x = entity.visible_position.x;
+    float x = state.targetable_positions[i].x;
 
     if (x < leftmost_x) {
       leftmost_x = x;
@@ -73,13 +66,14 @@ static EntityRecord GetRightmostNonSelectedTarget(State& state) {
   float rightmost_x = -FLT_MAX;
   EntityRecord candidate;
 
-  for (auto& record : state.targetable_entities) {
+  for (size_t i = 0; i < state.targetable_entities.size(); i++) {
+    auto& record = state.targetable_entities[i];
+
     if (IsSameEntity(record, state.target_entity)) {
       continue;
     }
 
-    auto& entity = *EntityManager::FindEntity(state, record);
-    float x = entity.visible_position.x;
+    float x = state.targetable_positions[i].x;
 
     if (x > rightmost_x) {
       rightmost_x = x;
@@ -90,30 +84,89 @@ static EntityRecord GetRightmostNonSelectedTarget(State& state) {
   return candidate;
 }
 
-static void TrackTargetableEntities(State& state, const std::vector<GameEntity>& entities) {
-  for (auto& entity : entities) {
-    // Prevent targeting enemies outside of their astro time range
-    if (!IsDuringActiveTime(entity, state)) continue;
+static inline int32 GetTargetableCell(const float coordinate) {
+  return (int32)floorf(coordinate / targetable_cell_size);
+}
+
+static inline uint64 GetTargetableCellKey(const int32 cell_x, const int32 cell_z) {
+  return (uint64(uint32(cell_x)) << 32) | uint64(uint32(cell_z));
+}
+
+static inline bool IsTargetableEntityType(const EntityType type) {
+  return (
+    type == LESSER_GUARD ||
+    type == LOW_GUARD ||
+    type == BANDIT ||
+    type == FAERIE
+  );
+}
+
+static void RemoveFromTargetableCell(TargetableIndex& index, const uint64 cell_key, const int32 entity_id) {
+  auto cell = index.cells.find(cell_key);
+
+  if (cell == index.cells.end()) {
+    return;
+  }
 
-    // Prevent targeting dead/defeated enemies
-    if (entity.enemy_state.health <= 0.f) continue;
+  auto& records = cell->second;
 
-    float player_distance = tVec3f::distance(entity.visible_position, state.player_position);
+  for (size_t i = 0; i < records.size(); i++) {
+    if (records[i].id == entity_id) {
+      records[i] = records.back();
+      records.pop_back();
 
-    if (player_distance < target_distance_limit) {
-      state.targetable_entities.push_back(GetRecord(entity));
+      break;
     }
   }
+
+  if (records.size() == 0) {
+    index.cells.erase(cell);
+  }
 }
 
+/**
+ * Collects targetable enemies from the grid cells overlapping
+ * the targeting range around the player, rather than checking
+ * every enemy.
+ */
 static void TrackAllTargetableEntities(Tachyon* tachyon, State& state) {
+  auto& index = state.targetable_index;
+
   state.targetable_entities.clear();
+  state.targetable_positions.clear();
 
   if (!state.enemies_disabled) {
-    TrackTargetableEntities(state, state.lesser_guards);
-    TrackTargetableEntities(state, state.low_guards);
-    TrackTargetableEntities(state, state.bandits);
-    TrackTargetableEntities(state, state.faeries);
+    int32 min_x = GetTargetableCell(state.player_position.x - target_distance_limit);
+    int32 max_x = GetTargetableCell(state.player_position.x + target_distance_limit);
+    int32 min_z = GetTargetableCell(state.player_position.z - target_distance_limit);
+    int32 max_z = GetTargetableCell(state.player_position.z + target_distance_limit);
+
+    for (int32 cell_x = min_x; cell_x <= max_x; cell_x++) {
+      for (int32 cell_z = min_z; cell_z <= max_z; cell_z++) {
+        auto cell = index.cells.find(GetTargetableCellKey(cell_x, cell_z));
+
+        if (cell == index.cells.end()) continue;
+
+        for (auto& record : cell->second) {
+          auto* entity = EntityManager::FindEntity(state, record);
+
+          if (entity == nullptr) continue;
+
+          // Prevent targeting enemies outside of their astro time range
+          if (!IsDuringActiveTime(*entity, state)) continue;
+
+          // Prevent targeting dead/defeated enemies
+          if (entity->enemy_state.health <= 0.f) continue;
+
+          float player_distance = tVec3f::distance(entity->visible_position, state.player_position);
+
+          if (player_distance < target_distance_limit) {
+            state.targetable_entities.push_back(record);
+            state.targetable_positions.push_back(entity->visible_position);
+          }
+        }
+      }
+    }
   }
 
   // If the current target entity is not found
@@ -237,18 +290,18 @@ void Targeting::SelectNextAccessibleTarget(Tachyon* tachyon, State& state) {
     auto& current_target = *EntityManager::FindEntity(state, state.target_entity);
     float lowest_right_distance = FLT_MAX;
 
-    for (auto& target : state.targetable_entities) {
-      auto& next_target = *EntityManager::FindEntity(state, target);
-      float x_distance = next_target.visible_position.x - current_target.visible_position.x;
+    for (size_t i = 0; i < state.targetable_entities.size(); i++) {
+      auto& target = state.targetable_entities[i];
+      float x_distance = state.targetable_positions[i].x - current_target.visible_position.x;
 
       // Skip left-side targets and the current target
-      if (x_distance < 0.f || IsSameEntity(current_target, next_target)) {
+      if (x_distance < 0.f || IsSameEntity(state.target_entity, target)) {
         continue;
       }
 
       if (x_distance < lowest_right_distance) {
         lowest_right_distance = x_distance;
-        new_target = next_target;
+        new_target = target;
       }
     }
   } else {
@@ -273,18 +326,18 @@ void Targeting::SelectPreviousAccessibleTarget(Tachyon* tachyon, State& state) {
     auto& current_target = *EntityManager::FindEntity(state, state.target_entity);
     float lowest_left_distance = FLT_MAX;
 
-    for (auto& target : state.targetable_entities) {
-      auto& next_target = *EntityManager::FindEntity(state, target);
-      float x_distance = current_target.visible_position.x - next_target.visible_position.x;
+    for (size_t i = 0; i < state.targetable_entities.size(); i++) {
+      auto& target = state.targetable_entities[i];
+      float x_distance = current_target.visible_position.x - state.targetable_positions[i].x;
 
       // Skip right-side targets and the current target
-      if (x_distance < 0.f || IsSameEntity(current_target, next_target)) {
+      if (x_distance < 0.f || IsSameEntity(state.target_entity, target)) {
         continue;
       }
 
       if (x_distance < lowest_left_distance) {
         lowest_left_distance = x_distance;
-        new_target = next_target;
+        new_target = target;
       }
     }
   } else {
@@ -331,4 +384,44 @@ bool Targeting::IsInCombatMode(State& state) {
   }
 
   return false;
+}
+
+/**
+ * Moves an enemy into the targetable index cell for its current
+ * position, if it isn't there already. Called as enemies spawn
+ * and as they move each frame.
+ */
+void Targeting::UpdateTargetableEntity(State& state, const GameEntity& entity) {
+  if (!IsTargetableEntityType(entity.type)) {
+    return;
+  }
+
+  auto& index = state.targetable_index;
+  auto& position = entity.visible_position;
+  uint64 cell_key = GetTargetableCellKey(GetTargetableCell(position.x), GetTargetableCell(position.z));
+  auto entry = index.entity_cells.find(entity.id);
+
+  if (entry != index.entity_cells.end()) {
+    if (entry->second == cell_key) {
+      return;
+    }
+
+    RemoveFromTargetableCell(index, entry->second, entity.id);
+  }
+
+  index.cells[cell_key].push_back(GetRecord(entity));
+  index.entity_cells[entity.id] = cell_key;
+}
+
+void Targeting::RemoveTargetableEntity(State& state, const EntityRecord& record) {
+  auto& index = state.targetable_index;
+  auto entry = index.entity_cells.find(record.id);
+
+  if (entry == index.entity_cells.end()) {
+    return;
+  }
+
+  RemoveFromTargetableCell(index, entry->second, record.id);
+
+  index.entity_cells.erase(entry);
 }
\ No newline at end of file
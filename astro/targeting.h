@@ -12,5 +12,7 @@ namespace astro {
     void SelectTarget(Tachyon* tachyon, State& state, EntityRecord& target);
     void DeselectCurrentTarget(Tachyon* tachyon, State& state);
     bool IsInCombatMode(State& state);
+    void UpdateTargetableEntity(State& state, const GameEntity& entity);
+    void RemoveTargetableEntity(State& state, const EntityRecord& record);
   }
 }
\ No newline at end of file
@@ -165,13 +165,92 @@ void TimeEvolution::HandleAstroTravel(Tachyon* tachyon, State& state) {
   }
 }
 
+static EntityEvolutionInputs GetEntityEvolutionInputs(State& state) {
+  EntityEvolutionInputs inputs;
+  inputs.astro_time = state.astro_time;
+  inputs.player_position = state.player_position;
+  inputs.water_level = state.water_level;
+  inputs.current_location = state.current_location;
+  inputs.use_vantage_camera = state.use_vantage_camera;
+  inputs.is_valid = true;
+
+  return inputs;
+}
+
+static inline bool IsSameEntityEvolutionInputs(const EntityEvolutionInputs& a, const EntityEvolutionInputs& b) {
+  return (
+    a.is_valid &&
+    b.is_valid &&
+    a.astro_time == b.astro_time &&
+    a.player_position == b.player_position &&
+    a.water_level == b.water_level &&
+    a.current_location == b.current_location &&
+    a.use_vantage_camera == b.use_vantage_camera
+  );
+}
+
+/**
+ * Time-evolves a batch of parallel entity types on the job workers,
+ * skipping static types whose inputs haven't changed since they
+ * were last evolved.
+ */
+static void TimeEvolveParallelEntityTypes(Tachyon* tachyon, State& state, std::vector<EntityType>& types) {
+  auto inputs = GetEntityEvolutionInputs(state);
+  auto& evolved_inputs = state.entity_evolution_inputs;
+  uint32 total_types = 0;
+
+  // Entities being moved by events have their visible positions
+  // reset by time evolution, so don't skip anything while they move
+  bool allow_skipping = state.move_events.size() == 0;
+
+  for (auto type : types) {
+    if ((size_t)type >= evolved_inputs.size()) {
+      evolved_inputs.resize(type + 1);
+    }
+
+    if (
+      allow_skipping &&
+      EntityDispatcher::IsTimeEvolutionStatic(type) &&
+      IsSameEntityEvolutionInputs(evolved_inputs[type], inputs)
+    ) {
+      continue;
+    }
+
+    evolved_inputs[type] = inputs;
+    types[total_types++] = type;
+  }
+
+  parallel_for(total_types, [&](uint32 i) {
+    EntityDispatcher::TimeEvolve(tachyon, state, types[i]);
+  });
+
+  types.clear();
+}
+
 void TimeEvolution::UpdateAstroTime(Tachyon* tachyon, State& state) {
   profile("UpdateAstroTime()");
 
+  static std::vector<EntityType> parallel_types;
+
+  // Serial types are evolved in order as they come up. Parallel types
+  // are batched up and evolved together, either before the next type
+  // which changes their inputs, or once every type has been visited.
   for_all_entity_types() {
+    if (EntityDispatcher::CanTimeEvolveInParallel(type)) {
+      parallel_types.push_back(type);
+
+      continue;
+    }
+
+    if (EntityDispatcher::ChangesTimeEvolutionInputs(type)) {
+      TimeEvolveParallelEntityTypes(tachyon, state, parallel_types);
+    }
+
     EntityDispatcher::TimeEvolve(tachyon, state, type);
   }
 
+  TimeEvolveParallelEntityTypes(tachyon, state, parallel_types);
+
   // Water
   tachyon->fx.water_time += state.dt + 2.f * state.astro_turn_speed;
 
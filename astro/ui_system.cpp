@@ -1,4 +1,5 @@
 #include "astro/ui_system.h"
+#include "astro/entity_manager.h"
 
 using namespace astro;
 
@@ -9,6 +10,7 @@ static bool MapHasKey(const std::unordered_map<std::string, T>& map, const std::
 
 static void CompleteCurrentDialogueSet(State& state) {
   state.current_dialogue_set = "";
+  state.current_dialogue_set_symbol = 0;
   state.current_dialogue_step = 0;
 }
 
@@ -101,6 +103,7 @@ void UISystem::StartDialogueSet(State& state, const std::string& set_name) {
   auto& dialogue_set = state.dialogue_map[set_name];
 
   state.current_dialogue_set = set_name;
+  state.current_dialogue_set_symbol = EntityManager::GetNameSymbol(state, set_name);
 
   if (dialogue_set.invoked) {
     // Check to see if secondary dialogue is defined for the subject;
@@ -19,6 +19,15 @@ static Quaternion DirectionToQuaternion(const tVec3f& direction) {
   );
 }
 
+// Vehicles further than this from the camera only have their
+// objects and lights updated every few frames
+constexpr static float REDUCED_UPDATE_DISTANCE = 1000000.f;
+constexpr static uint32 REDUCED_UPDATE_INTERVAL = 4;
+
+constexpr static float FLYING_SHIP_SCALE = 8000.f;
+constexpr static float FLYING_SHIP_SPEED = 25000.f;
+constexpr static float CARGO_FERRY_SPEED = 50000.f;
+
 static void RebuildVehicleNetwork(Tachyon* tachyon, State& state) {
   auto& meshes = state.meshes;
   auto& network = state.vehicle_network;
@@ -34,28 +43,80 @@ static void RebuildVehicleNetwork(Tachyon* tachyon, State& state) {
 
   // Connect nodes within range
   for (auto& node : network) {
-    for (auto& node2 : network) {
-      float distance = (node.position - node2.position).magnitude();
+    for (uint32 i = 0; i < network.size(); i++) {
+      float distance = (node.position - network[i].position).magnitude();
 
       if (distance > 10000.f && distance < 1700000.f) {
-        node.connected_nodes.push_back(node2);
+        node.connected_node_indexes.push_back(i);
       }
     }
   }
 }
 
+static uint32 AddVehicleRoute(State& state, const tVec3f& start, const tVec3f& end, bool face_backward) {
+  auto& routes = state.vehicle_traffic.routes;
+  tVec3f start_to_end = end - start;
+  VehicleRoute route;
+
+  route.start = start;
+  route.length = start_to_end.magnitude();
+  route.direction = start_to_end / route.length;
+  route.rotation = DirectionToQuaternion(face_backward ? route.direction.invert() : route.direction);
+
+  auto matrix = route.rotation.toMatrix4f();
+
+  route.light_offset_1 = matrix.transformVec3f(tVec3f(-0.2f, 0, -0.95f) * FLYING_SHIP_SCALE);
+  route.light_offset_2 = matrix.transformVec3f(tVec3f(0.2f, 0, -0.95f) * FLYING_SHIP_SCALE);
+
+  routes.push_back(route);
+
+  return uint32(routes.size() - 1);
+}
+
+static void AddVehicle(
+  State& state,
+  BackgroundVehicleType type,
+  uint32 route_index,
+  const tVec3f& offset,
+  float distance,
+  float speed,
+  const std::vector<tObject>& parts,
+  uint32 light_indexes_offset
+) {
+  auto& traffic = state.vehicle_traffic;
+
+  traffic.types.push_back(type);
+  traffic.route_indexes.push_back(route_index);
+  traffic.offsets.push_back(offset);
+  traffic.distances.push_back(distance);
+  traffic.speeds.push_back(speed);
+  traffic.parts_offsets.push_back(uint32(traffic.parts.size()));
+  traffic.total_parts.push_back(uint8(parts.size()));
+  traffic.light_indexes_offsets.push_back(light_indexes_offset);
+
+  for (auto& part : parts) {
+    traffic.parts.push_back(part);
+  }
+}
+
 static void SpawnFlyingShips(Tachyon* tachyon, State& state) {
   auto& point_lights = tachyon->point_lights;
   auto& meshes = state.meshes;
-  auto& vehicles = state.vehicles;
+  auto& network = state.vehicle_network;
 
-  for (auto& node : state.vehicle_network) {
-    uint32 spawn_total = node.connected_nodes.size() * 3;
+  for (auto& node : network) {
+    std::vector<uint32> route_indexes;
+
+    for (auto node_index : node.connected_node_indexes) {
+      route_indexes.push_back(AddVehicleRoute(state, node.position, network[node_index].position, false));
+    }
+
+    uint32 spawn_total = node.connected_node_indexes.size() * 3;
 
     for (uint32 i = 0; i < spawn_total; i++) {
       auto& ship = create(meshes.flying_ship_1);
-      auto target_node_index = (int)(Tachyon_GetRandom() * node.connected_nodes.size());
-      auto& target_node = node.connected_nodes[target_node_index];
+      auto route_index = route_indexes[(int)(Tachyon_GetRandom() * route_indexes.size())];
+      auto& route = state.vehicle_traffic.routes[route_index];
       float progress = Tachyon_GetRandom();
 
       tVec3f offset = tVec3f(
@@ -64,17 +125,13 @@ static void SpawnFlyingShips(Tachyon* tachyon, State& state) {
         Tachyon_GetRandom(0.f, 40000.f)
       );
 
-      ship.position = tVec3f::lerp(node.position, target_node.position, progress) + offset;
-      ship.scale = 8000.f;
+      ship.position = route.start + route.direction * route.length * progress + offset;
+      ship.rotation = route.rotation;
+      ship.scale = FLYING_SHIP_SCALE;
 
       commit(ship);
 
-      vehicles.push_back({
-        .parts = { ship },
-        .spawn_position = node.position + offset,
-        .target_position = target_node.position + offset,
-        .light_indexes_offset = uint32(point_lights.size())
-      });
+      AddVehicle(state, FLYING_SHIP, route_index, offset, route.length * progress, FLYING_SHIP_SPEED, { ship }, uint32(point_lights.size()));
 
       point_lights.push_back({
         .position = ship.position,
@@ -94,7 +151,7 @@ static void SpawnFlyingShips(Tachyon* tachyon, State& state) {
 }
 
 // @todo accept position/rotation
-static void SpawnMovingCargoFerry(Tachyon* tachyon, const State& state, BackgroundVehicle& vehicle) {
+static std::vector<tObject> SpawnMovingCargoFerry(Tachyon* tachyon, const State& state) {
   auto& meshes = state.meshes;
 
   #define set_attributes(object, asset)\
@@ -124,7 +181,7 @@ static void SpawnMovingCargoFerry(Tachyon* tachyon, const State& state, Backgrou
 
   jets.color.rgba |= 0x000F;
 
-  vehicle.parts = { core, frame, thrusters, dock, jets };
+  return { core, frame, thrusters, dock, jets };
 }
 
 static void SpawnMovingCargoFerries(Tachyon* tachyon, State& state) {
@@ -134,10 +191,11 @@ static void SpawnMovingCargoFerries(Tachyon* tachyon, State& state) {
         continue;
       }
 
-      for (uint8 i = 0; i < 5; i++) {
-        BackgroundVehicle vehicle;
+      auto route_index = AddVehicleRoute(state, node.position, node2.position, true);
+      auto& route = state.vehicle_traffic.routes[route_index];
 
-        SpawnMovingCargoFerry(tachyon, state, vehicle);
+      for (uint8 i = 0; i < 5; i++) {
+        auto parts = SpawnMovingCargoFerry(tachyon, state);
 
         auto offset = tVec3f(
           Tachyon_GetRandom(-1.f, 1.f),
@@ -145,58 +203,36 @@ static void SpawnMovingCargoFerries(Tachyon* tachyon, State& state) {
           Tachyon_GetRandom(-1.f, 1.f)
         ) * 20000.f;
 
-        vehicle.spawn_position = node.position + offset;
-        vehicle.target_position = node2.position + offset;
-
-        auto position =
-          tVec3f::lerp(node.position, node2.position, Tachyon_GetRandom());
+        float distance = route.length * Tachyon_GetRandom();
 
         // @temporary
         // @todo move into SpawnMovingCargoFerry()
-        for (auto& part : vehicle.parts) {
+        for (auto& part : parts) {
           auto& live_part = *get_live_object(part);
 
-          live_part.position = position;
+          live_part.position = route.start + route.direction * distance + offset;
+          live_part.rotation = route.rotation;
 
           commit(live_part);
         }
 
-        state.vehicles.push_back(vehicle);
+        AddVehicle(state, CARGO_FERRY, route_index, offset, distance, CARGO_FERRY_SPEED, parts, 0);
       }
     }
   }
 }
 
-static void UpdateFlyingShip(Tachyon* tachyon, BackgroundVehicle& vehicle, const float dt) {
+static void UpdateFlyingShipLights(Tachyon* tachyon, const VehicleRoute& route, const uint32 light_indexes_offset, const tVec3f& position, const float distance_to_camera) {
   auto& point_lights = tachyon->point_lights;
-  auto& ship = *get_live_object(vehicle.parts[0]);
-  auto object_to_target = vehicle.target_position - ship.position;
-  auto distance = object_to_target.magnitude();
-  auto distance_to_camera = (ship.position - tachyon->scene.camera.position).magnitude();
-  auto direction = object_to_target / distance;
-
-  if (distance < 10000.f) {
-    ship.position = vehicle.spawn_position;
-  }
-
-  ship.position += direction * 25000.f * dt;
-  ship.rotation = DirectionToQuaternion(direction);
-
-  auto& light1 = point_lights[vehicle.light_indexes_offset];
-  auto& light2 = point_lights[vehicle.light_indexes_offset + 1];
-  auto matrix = ship.rotation.toMatrix4f();
+  auto& light1 = point_lights[light_indexes_offset];
+  auto& light2 = point_lights[light_indexes_offset + 1];
 
   float light_ratio = distance_to_camera / 2000000.f;
   if (light_ratio > 1.f) light_ratio = 1.f;
   light_ratio *= light_ratio;
 
-  light1.position =
-    ship.position +
-    matrix.transformVec3f(tVec3f(-0.2f, 0, -0.95f) * ship.scale);
-
-  light2.position =
-    ship.position +
-    matrix.transformVec3f(tVec3f(0.2f, 0, -0.95f) * ship.scale);
+  light1.position = position + route.light_offset_1;
+  light2.position = position + route.light_offset_2;
 
   light1.power =
   light2.power =
@@ -205,37 +241,6 @@ static void UpdateFlyingShip(Tachyon* tachyon, BackgroundVehicle& vehicle, const
   light1.radius =
   light2.radius =
   2000.f + 20000.f * light_ratio;
-
-  commit(ship);
-}
-
-static void UpdateCargoFerry(Tachyon* tachyon, BackgroundVehicle& vehicle, const float dt) {
-  auto& ship = *get_live_object(vehicle.parts[0]);
-  auto object_to_target = vehicle.target_position - ship.position;
-  auto spawn_distance = (vehicle.spawn_position - ship.position).magnitude();
-  auto target_distance = object_to_target.magnitude();
-  auto direction = object_to_target / target_distance;
-
-  if (target_distance < 10000.f) {
-    ship.position = vehicle.spawn_position;
-  }
-
-  float speed_blend = 1.f - std::min(spawn_distance, target_distance) / 200000.f;
-  if (speed_blend < 0.f) speed_blend = 0.f;
-
-  float speed = Tachyon_Lerpf(50000.f, 10000.f, speed_blend);
-
-  ship.position += direction * speed * dt;
-  ship.rotation = DirectionToQuaternion(direction.invert());
-
-  for (auto& part : vehicle.parts) {
-    auto& live_part = *get_live_object(part);
-
-    live_part.position = ship.position;
-    live_part.rotation = ship.rotation;
-
-    commit(live_part);
-  }
 }
 
 void BackgroundVehicles::LoadVehicleMeshes(Tachyon* tachyon, State& state) {
@@ -249,14 +254,13 @@ void BackgroundVehicles::LoadVehicleMeshes(Tachyon* tachyon, State& state) {
 }
 
 void BackgroundVehicles::InitVehicles(Tachyon* tachyon, State& state) {
-  auto& point_lights = tachyon->point_lights;
-  auto& vehicles = state.vehicles;
+  auto& traffic = state.vehicle_traffic;
   auto& network = state.vehicle_network;
   auto& meshes = state.meshes;
 
   // Reset vehicle instances/objects
   {
-    vehicles.clear();
+    traffic = VehicleTraffic();
     network.clear();
 
     remove_all(meshes.flying_ship_1);
@@ -276,20 +280,62 @@ void BackgroundVehicles::InitVehicles(Tachyon* tachyon, State& state) {
 
 void BackgroundVehicles::UpdateVehicles(Tachyon* tachyon, State& state, const float dt) {
   auto start = Tachyon_GetMicroseconds();
-  auto& point_lights = tachyon->point_lights;
+  auto& traffic = state.vehicle_traffic;
+  auto& camera_position = tachyon->scene.camera.position;
+  uint32 total_vehicles = uint32(traffic.types.size());
+
+  // Advance all vehicles along their routes
+  for (uint32 i = 0; i < total_vehicles; i++) {
+    auto& route = traffic.routes[traffic.route_indexes[i]];
+    float distance = traffic.distances[i];
+    float speed = traffic.speeds[i];
+
+    if (traffic.types[i] == CARGO_FERRY) {
+      // Slow down close to either end of the route
+      float speed_blend = 1.f - std::min(distance, route.length - distance) / 200000.f;
+      if (speed_blend < 0.f) speed_blend = 0.f;
+
+      speed = Tachyon_Lerpf(speed, 10000.f, speed_blend);
+    }
+
+    if (distance > route.length - 10000.f) {
+      distance = 0.f;
+    }
+
+    traffic.distances[i] = distance + speed * dt;
+  }
+
+  // Update vehicle objects and lights
+  for (uint32 i = 0; i < total_vehicles; i++) {
+    auto& route = traffic.routes[traffic.route_indexes[i]];
+    tVec3f position = route.start + route.direction * traffic.distances[i] + traffic.offsets[i];
+    float distance_to_camera = (position - camera_position).magnitude();
+
+    if (
+      distance_to_camera > REDUCED_UPDATE_DISTANCE &&
+      (i + traffic.update_cycle) % REDUCED_UPDATE_INTERVAL != 0
+    ) {
+      continue;
+    }
 
-  for (auto& vehicle : state.vehicles) {
-    auto& main_part = vehicle.parts[0];
+    uint32 parts_offset = traffic.parts_offsets[i];
 
-    if (main_part.mesh_index == state.meshes.flying_ship_1) {
-      UpdateFlyingShip(tachyon, vehicle, dt);
+    for (uint32 j = parts_offset; j < parts_offset + traffic.total_parts[i]; j++) {
+      auto& part = *get_live_object(traffic.parts[j]);
+
+      part.position = position;
+      part.rotation = route.rotation;
+
+      commit(part);
     }
 
-    if (main_part.mesh_index == state.meshes.freight_core) {
-      UpdateCargoFerry(tachyon, vehicle, dt);
+    if (traffic.types[i] == FLYING_SHIP) {
+      UpdateFlyingShipLights(tachyon, route, traffic.light_indexes_offsets[i], position, distance_to_camera);
     }
   }
 
+  traffic.update_cycle++;
+
   auto t = Tachyon_GetMicroseconds() - start;
 
   // @todo dev mode only
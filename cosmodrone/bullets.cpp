@@ -1,70 +1,157 @@
+#include <algorithm>
+
 #include "cosmodrone/bullets.h"
+#include "cosmodrone/mesh_library.h"
 
 using namespace Cosmodrone;
 
-// @todo move to engine
-template<class T>
-static inline void RemoveFromArray(std::vector<T>& array, uint32 index) {
-  array.erase(array.begin() + index);
+const static float PROJECTILE_LIFETIME = 5.f;
+
+/**
+ * ----------------------------
+ * Indexes world geometry which projectiles can collide with.
+ * Colliders are bounded by spheres, so objects which spin
+ * in place (e.g. station tori) keep valid bounds.
+ * ----------------------------
+ */
+static void InitProjectileColliders(Tachyon* tachyon, State& state) {
+  auto& colliders = state.projectile_colliders;
+
+  // @allocation
+  std::vector<tBounds> collider_bounds;
+
+  colliders.clear();
+
+  auto add_colliders = [&](const std::vector<MeshAsset>& assets) {
+    for (auto& asset : assets) {
+      if (asset.placeholder || asset.moving) continue;
+
+      tBounds local_bounds = Tachyon_GetMeshBounds(tachyon, asset.mesh_index);
+      float local_radius = std::max(local_bounds.min.magnitude(), local_bounds.max.magnitude());
+
+      for (auto& object : objects(asset.mesh_index)) {
+        float scale = std::max({ abs(object.scale.x), abs(object.scale.y), abs(object.scale.z) });
+
+        colliders.push_back({ object, local_bounds });
+        collider_bounds.push_back(Tachyon_GetSphereBounds(object.position, local_radius * scale));
+      }
+    }
+  };
+
+  add_colliders(MeshLibrary::GetPlaceableMeshAssets());
+  add_colliders(MeshLibrary::GetGeneratedMeshAssets());
+
+  Tachyon_BuildBVH(state.projectile_collider_bvh, collider_bounds);
 }
 
-static float GetLastSpawnTime(const std::vector<Bullet>& bullets) {
-  if (bullets.size() > 0) {
-    return bullets.back().spawn_time;
+/**
+ * ----------------------------
+ * Determines whether a projectile sweeping from start to end
+ * hits any world geometry. Candidates from the broadphase are
+ * tested against their oriented bounding boxes.
+ * ----------------------------
+ */
+static bool DidHitWorld(Tachyon* tachyon, State& state, const tVec3f& start, const tVec3f& end, const float radius) {
+  auto& candidates = state.projectile_hit_candidates;
+  tBounds swept_bounds = Tachyon_GetSweptSphereBounds(start, end, radius);
+
+  Tachyon_QueryBVHBounds(state.projectile_collider_bvh, swept_bounds, candidates);
+
+  for (auto index : candidates) {
+    auto& collider = state.projectile_colliders[index];
+    tObject* object = get_live_object(collider.object);
+
+    if (object == nullptr) {
+      continue;
+    }
+
+    // Transform the swept segment into the collider's local space
+    tMat4f inverse_rotation = object->rotation.opposite().toMatrix4f();
+    tVec3f inverse_scale = tVec3f(1.f / object->scale.x, 1.f / object->scale.y, 1.f / object->scale.z);
+    tVec3f local_start = (inverse_rotation * (start - object->position)) * inverse_scale;
+    tVec3f local_end = (inverse_rotation * (end - object->position)) * inverse_scale;
+    // Mirrored (negatively-scaled) colliders still need the
+    // bounds to grow by the radius, rather than shrink
+    tVec3f local_radius = tVec3f(abs(inverse_scale.x), abs(inverse_scale.y), abs(inverse_scale.z)) * radius;
+
+    tBounds bounds = {
+      collider.local_bounds.min - local_radius,
+      collider.local_bounds.max + local_radius
+    };
+
+    if (Tachyon_SegmentIntersectsBounds(bounds, local_start, local_end)) {
+      return true;
+    }
   }
 
-  return 0.f;
+  return false;
 }
 
-static void UpdateMachineGunBullets(Tachyon* tachyon, State& state, const float dt) {
-  uint8 i = 0;
-
-  while (i < state.machine_gun_bullets.size()) {
-    auto& bullet = state.machine_gun_bullets[i];
-    auto& object = *get_live_object(bullet.object);
+static void DespawnProjectile(Tachyon* tachyon, std::vector<Bullet>& projectiles, const uint32 index) {
+  remove_object(projectiles[index].object);
 
-    if (state.current_game_time - bullet.spawn_time > 5.f) {
-      // Despawn
-      object.scale = 0.f;
+  projectiles[index] = projectiles.back();
+  projectiles.pop_back();
+}
 
-      RemoveFromArray(state.machine_gun_bullets, (uint32)i);
+static void SpawnProjectile(Tachyon* tachyon, State& state, std::vector<Bullet>& projectiles, const uint16 mesh_index, const tVec3f& position, const float scale, const tVec4f& color) {
+  auto& group = objects(mesh_index);
 
-      continue;
+  if (group.total_active == group.total) {
+    // The group is full of instances which aren't ours to recycle
+    if (projectiles.size() == 0) {
+      return;
     }
 
-    object.position += bullet.direction * 500000.f * dt;
+    // Recycle the oldest projectile's instance
+    uint32 oldest_index = 0;
 
-    i++;
-  }
+    for (uint32 i = 1; i < projectiles.size(); i++) {
+      if (projectiles[i].spawn_time < projectiles[oldest_index].spawn_time) {
+        oldest_index = i;
+      }
+    }
 
-  for (auto& bullet : objects(state.meshes.bullet_1)) {
-    commit(bullet);
+    DespawnProjectile(tachyon, projectiles, oldest_index);
   }
-}
 
-static void UpdateMissiles(Tachyon* tachyon, State& state, const float dt) {
-  uint8 i = 0;
+  auto& object = create(mesh_index);
 
-  while (i < state.missiles.size()) {
-    auto& bullet = state.missiles[i];
-    auto& object = *get_live_object(bullet.object);
+  object.position = position;
+  object.scale = tVec3f(scale);
+  object.color = color;
 
-    if (state.current_game_time - bullet.spawn_time > 5.f) {
-      // Despawn
-      object.scale = 0.f;
+  commit(object);
 
-      RemoveFromArray(state.missiles, (uint32)i);
+  projectiles.push_back({
+    .direction = state.ship_rotation_basis.forward,
+    .object = object,
+    .spawn_time = state.current_game_time
+  });
+}
+
+static void UpdateProjectiles(Tachyon* tachyon, State& state, std::vector<Bullet>& projectiles, const float speed, const float dt) {
+  uint32 i = 0;
+
+  while (i < projectiles.size()) {
+    auto& projectile = projectiles[i];
+    auto& object = *get_live_object(projectile.object);
+    tVec3f next_position = object.position + projectile.direction * speed * dt;
+
+    if (
+      state.current_game_time - projectile.spawn_time > PROJECTILE_LIFETIME ||
+      DidHitWorld(tachyon, state, object.position, next_position, object.scale.x)
+    ) {
+      DespawnProjectile(tachyon, projectiles, i);
 
       continue;
     }
 
-    object.position += bullet.direction * 200000.f * dt;
+    object.position = next_position;
 
-    i++;
-  }
+    commit(object);
 
-  for (auto& missile : objects(state.meshes.missile_1)) {
-    commit(missile);
+    i++;
   }
 }
 
@@ -74,76 +161,43 @@ void Bullets::InitBullets(Tachyon* tachyon, State& state) {
   remove_all(meshes.bullet_1);
   remove_all(meshes.missile_1);
 
-  for (uint8 i = 0; i < 100; i++) {
-    create(meshes.bullet_1);
-    create(meshes.missile_1);
-  }
+  state.machine_gun_bullets.clear();
+  state.missiles.clear();
+  state.machine_gun_bullets.reserve(objects(meshes.bullet_1).total);
+  state.missiles.reserve(objects(meshes.missile_1).total);
+
+  InitProjectileColliders(tachyon, state);
 }
 
 void Bullets::FireMachineGuns(Tachyon* tachyon, State& state) {
-  if (state.next_machine_gun_bullet_index == 100) {
-    state.next_machine_gun_bullet_index = 0;
-  }
-
-  if (state.current_game_time - GetLastSpawnTime(state.machine_gun_bullets) < 0.1f) {
+  if (state.current_game_time - state.last_machine_gun_fire_time < 0.1f) {
     return;
   }
 
-  auto& object = objects(state.meshes.bullet_1)[state.next_machine_gun_bullet_index++];
-  auto& object2 = objects(state.meshes.bullet_1)[state.next_machine_gun_bullet_index++];
-
-  object.position =
-    state.ship_position -
-    state.ship_rotation_basis.up * 1400.f +
-    state.ship_rotation_basis.sideways * 1900.f;
-
-  object2.position =
-    state.ship_position -
-    state.ship_rotation_basis.up * 1400.f -
-    state.ship_rotation_basis.sideways * 1900.f;
-
-  object.scale =
-  object2.scale = tVec3f(200.f);
+  auto& basis = state.ship_rotation_basis;
+  auto color = tVec4f(1.f, 0.2f, 0.2f, 1.f);
 
-  object.color =
-  object2.color = tVec4f(1.f, 0.2f, 0.2f, 1.f);
+  SpawnProjectile(tachyon, state, state.machine_gun_bullets, state.meshes.bullet_1,
+    state.ship_position - basis.up * 1400.f + basis.sideways * 1900.f, 200.f, color);
 
-  state.machine_gun_bullets.push_back({
-    .direction = state.ship_rotation_basis.forward,
-    .object = object,
-    .spawn_time = state.current_game_time
-  });
+  SpawnProjectile(tachyon, state, state.machine_gun_bullets, state.meshes.bullet_1,
+    state.ship_position - basis.up * 1400.f - basis.sideways * 1900.f, 200.f, color);
 
-  state.machine_gun_bullets.push_back({
-    .direction = state.ship_rotation_basis.forward,
-    .object = object2,
-    .spawn_time = state.current_game_time
-  });
+  state.last_machine_gun_fire_time = state.current_game_time;
 }
 
 void Bullets::FireMissile(Tachyon* tachyon, State& state) {
-  if (state.next_missile_index == 100) {
-    state.next_missile_index = 0;
-  }
-
-  if (state.current_game_time - GetLastSpawnTime(state.missiles) < 0.5f) {
+  if (state.current_game_time - state.last_missile_fire_time < 0.5f) {
     return;
   }
 
-  auto& object = objects(state.meshes.missile_1)[state.next_missile_index++];
+  SpawnProjectile(tachyon, state, state.missiles, state.meshes.missile_1,
+    state.ship_position, 500.f, tVec4f(0, 0, 1.f, 1.f));
 
-  object.position = state.ship_position;
-  object.scale = tVec3f(500.f);
-  object.color = tVec4f(0, 0, 1.f, 1.f);
-
-  state.missiles.push_back({
-    .direction = state.ship_rotation_basis.forward,
-    .object = object,
-    .spawn_time = state.current_game_time
-  });
+  state.last_missile_fire_time = state.current_game_time;
 }
 
 void Bullets::UpdateBullets(Tachyon* tachyon, State& state, const float dt) {
-  UpdateMachineGunBullets(tachyon, state, dt);
-  UpdateMissiles(tachyon, state, dt);
+  UpdateProjectiles(tachyon, state, state.machine_gun_bullets, 500000.f, dt);
+  UpdateProjectiles(tachyon, state, state.missiles, 200000.f, dt);
 }
\ No newline at end of file
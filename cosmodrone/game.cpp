@@ -953,6 +953,8 @@ static void ShowDevLabels(Tachyon* tachyon, State& state) {
 }
 
 void Cosmodrone::StartGame(Tachyon* tachyon) {
+  Tachyon_CheckRenderOriginPrecision();
+
   MeshLibrary::LoadMeshes(tachyon, state);
   WorldSetup::InitWorld(tachyon, state);
   Editor::InitializeEditor(tachyon, state);
@@ -991,6 +993,10 @@ void Cosmodrone::UpdateGame(Tachyon* tachyon, const float dt) {
   scene.z_near = 500.f;
   scene.z_far = 100000000.f;
 
+  // Keep object matrices relative to a point near the camera,
+  // since the station extends far from the world origin
+  Tachyon_RebaseRenderOrigin(tachyon, camera.origin + tVec3d(camera.position));
+
   // @todo factor
   if (state.last_scan_time != 0.f) {
     float scan_time = state.current_game_time - state.last_scan_time;
@@ -1,12 +1,15 @@
 #include <format>
 #include <math.h>
+#include <unordered_set>
 #include <vector>
 
 #include "cosmodrone/game_editor.h"
 #include "cosmodrone/mesh_library.h"
 #include "cosmodrone/object_behavior.h"
 #include "cosmodrone/procedural_generation.h"
+#include "cosmodrone/target_system.h"
 #include "cosmodrone/world_behavior.h"
+#include "cosmodrone/world_data.h"
 #include "cosmodrone/world_setup.h"
 
 #define case(value, __code)\
@@ -40,8 +43,22 @@ struct EditorState {
   bool was_object_selected_on_mouse_down = false;
   ActionType action_type = ActionType::POSITION;
 
+  // Selected objects, as they were before being selected
   std::vector<tObject> selected_objects;
+  // The index of each selected object in its object group,
+  // refreshed whenever objects are selected, created or removed
+  std::vector<uint16> selected_object_indexes;
   tVec3f selected_objects_origin;
+  bool should_commit_selected_objects = false;
+  bool was_selection_flashing = false;
+  uint64 last_selection_update_time = 0;
+
+  // Placeable objects, for picking
+  std::vector<tObject> pickable_objects;
+  tBVH pickable_objects_bvh;
+  std::vector<uint32> pick_candidates;
+  std::vector<float> pickable_mesh_radii;
+  bool is_pickable_objects_bvh_dirty = true;
 
   bool use_high_speed_camera_movement = false;
   float last_pressed_space_time = 0.f;
@@ -51,6 +68,32 @@ static bool AreObjectsSelected() {
   return editor.selected_objects.size() > 0;
 }
 
+static void RefreshSelectedObjectIndexes(Tachyon* tachyon) {
+  auto& indexes = editor.selected_object_indexes;
+
+  indexes.resize(editor.selected_objects.size());
+
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    auto& object = editor.selected_objects[i];
+
+    indexes[i] = objects(object.mesh_index).id_to_index[object.object_id];
+  }
+
+  editor.should_commit_selected_objects = true;
+  editor.is_pickable_objects_bvh_dirty = true;
+}
+
+static tObject& GetSelectedObject(Tachyon* tachyon, size_t selection_index) {
+  auto mesh_index = editor.selected_objects[selection_index].mesh_index;
+
+  return objects(mesh_index)[editor.selected_object_indexes[selection_index]];
+}
+
+static void ClearSelectedObjects() {
+  editor.selected_objects.clear();
+  editor.selected_object_indexes.clear();
+}
+
 static const MeshAsset& GetSelectedObjectPickerMeshAsset() {
   auto& placeable_meshes = MeshLibrary::GetPlaceableMeshAssets();
   auto& selected_mesh = placeable_meshes[editor.object_picker_index];
@@ -164,10 +207,14 @@ static void SaveWorldData(Tachyon* tachyon, State& state) {
     }
   }
 
+  // Write the binary world data after the text, so
+  // it is considered current when the world is loaded
   #if USE_PROCEDURAL_GENERATION == 1
     Tachyon_WriteFileContents("./cosmodrone/data/world_2.txt", data);
+    WorldData::SaveBinaryWorldData(tachyon, "./cosmodrone/data/world_2.bin");
   #else
     Tachyon_WriteFileContents("./cosmodrone/data/world.txt", data);
+    WorldData::SaveBinaryWorldData(tachyon, "./cosmodrone/data/world.bin");
   #endif
 
   auto save_time = Tachyon_GetMicroseconds() - start;
@@ -316,7 +363,7 @@ static void HandleObjectPickerCycleChange(Tachyon* tachyon) {
   tVec3f spawn_position = camera.position + camera.orientation.getDirection() * 4000.f;
 
   if (editor.is_object_picker_active && editor.selected_objects.size() == 1) {
-    spawn_position = get_live_object(editor.selected_objects[0])->position;
+    spawn_position = GetSelectedObject(tachyon, 0).position;
 
     remove_object(editor.selected_objects[0]);
   }
@@ -341,6 +388,8 @@ static void HandleObjectPickerCycleChange(Tachyon* tachyon) {
     editor.selected_objects[0] = selected;
   }
 
+  RefreshSelectedObjectIndexes(tachyon);
+
   editor.selected_objects_origin = spawn_position;
   editor.last_object_picker_cycle_time = tachyon->running_time;
 }
@@ -385,9 +434,29 @@ static void HandleRotationSnapping(float& running_angle, float& angle) {
   }
 }
 
+static void TranslateSelectedObjects(Tachyon* tachyon, const tVec3f& offset) {
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    GetSelectedObject(tachyon, i).position += offset;
+  }
+
+  editor.selected_objects_origin += offset;
+  editor.should_commit_selected_objects = true;
+  editor.is_pickable_objects_bvh_dirty = true;
+}
+
+static void RotateSelectedObjects(Tachyon* tachyon, const tVec3f& axis, const float angle) {
+  auto rotation = Quaternion::fromAxisAngle(axis, angle);
+
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    GetSelectedObject(tachyon, i).rotation *= rotation;
+  }
+
+  editor.should_commit_selected_objects = true;
+}
+
 static void HandleSelectedObjectMouseMovements(Tachyon* tachyon) {
   auto& camera = tachyon->scene.camera;
-  auto& first_selected = *get_live_object(editor.selected_objects[0]);
+  auto& first_selected = GetSelectedObject(tachyon, 0);
   auto is_horizontal_action = abs(tachyon->mouse_delta_x) > abs(tachyon->mouse_delta_y);
   auto camera_up = camera.orientation.getUpDirection();
   auto camera_right = camera.orientation.getRightDirection();
@@ -419,13 +488,7 @@ static void HandleSelectedObjectMouseMovements(Tachyon* tachyon) {
         offset = axis * -(float)tachyon->mouse_delta_y * movement_factor;
       }
 
-      for (auto& object : editor.selected_objects) {
-        auto& selected = *get_live_object(object);
-
-        selected.position += offset;
-      }
-
-      editor.selected_objects_origin += offset;
+      TranslateSelectedObjects(tachyon, offset);
     })
     case(ActionType::ROTATE, {
       constexpr static float SNAP_INCREMENT = t_PI / 12.f;
@@ -441,11 +504,7 @@ static void HandleSelectedObjectMouseMovements(Tachyon* tachyon) {
           HandleRotationSnapping(editor.running_angle_x, angle);
         }
 
-        for (auto& object : editor.selected_objects) {
-          auto& selected = *get_live_object(object);
-
-          selected.rotation *= Quaternion::fromAxisAngle(axis, angle);
-        }
+        RotateSelectedObjects(tachyon, axis, angle);
       } else {
         auto axis = GetMostSimilarObjectAxis(camera_right, first_selected);
         auto angle = (float)tachyon->mouse_delta_y * 0.005f;
@@ -456,11 +515,7 @@ static void HandleSelectedObjectMouseMovements(Tachyon* tachyon) {
           HandleRotationSnapping(editor.running_angle_y, angle);
         }
 
-        for (auto& object : editor.selected_objects) {
-          auto& selected = *get_live_object(object);
-
-          selected.rotation *= Quaternion::fromAxisAngle(axis, angle);
-        }
+        RotateSelectedObjects(tachyon, axis, angle);
       }
     })
     case(ActionType::SCALE, {
@@ -470,7 +525,9 @@ static void HandleSelectedObjectMouseMovements(Tachyon* tachyon) {
 }
 
 static void ResetSelectedObjectTransform(Tachyon* tachyon) {
-  auto& selected = *get_live_object(editor.selected_objects[0]);
+  auto& selected = GetSelectedObject(tachyon, 0);
+
+  editor.should_commit_selected_objects = true;
 
   switch (editor.action_type) {
     case(ActionType::ROTATE, {
@@ -483,10 +540,10 @@ static void ResetSelectedObjectTransform(Tachyon* tachyon) {
 }
 
 static void RestoreSelectedObjectColors(Tachyon* tachyon) {
-  for (auto& object : editor.selected_objects) {
-    auto& live = *get_live_object(object);
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    auto& live = GetSelectedObject(tachyon, i);
 
-    live.color = object.color;
+    live.color = editor.selected_objects[i].color;
 
     commit(live);
   }
@@ -495,10 +552,8 @@ static void RestoreSelectedObjectColors(Tachyon* tachyon) {
 static void RecalculateSelectedObjectsOrigin(Tachyon* tachyon) {
   tVec3f average;
 
-  for (auto& object : editor.selected_objects) {
-    auto& live = *get_live_object(object);
-
-    average += live.position;
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    average += GetSelectedObject(tachyon, i).position;
   }
 
   editor.selected_objects_origin = average / float(editor.selected_objects.size());
@@ -512,7 +567,7 @@ static void CopySelectedObjects(Tachyon* tachyon, State& state, Direction direct
   RestoreSelectedObjectColors(tachyon);
 
   auto& camera = tachyon->scene.camera;
-  auto& first_selected = *get_live_object(editor.selected_objects[0]);
+  tObject first_selected = GetSelectedObject(tachyon, 0);
   tVec3f move_distance = first_selected.scale;
 
   if (editor.selected_objects.size() == 1) {
@@ -546,8 +601,8 @@ static void CopySelectedObjects(Tachyon* tachyon, State& state, Direction direct
     }
   }
 
-  for (auto& object : editor.selected_objects) {
-    auto& original = *get_live_object(object);
+  for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+    tObject original = GetSelectedObject(tachyon, i);
     auto& copy = create(original.mesh_index);
 
     copy.rotation = original.rotation;
@@ -576,21 +631,49 @@ static void CopySelectedObjects(Tachyon* tachyon, State& state, Direction direct
 
     commit(copy);
 
-    object = copy;
+    editor.selected_objects[i] = copy;
   }
 
+  RefreshSelectedObjectIndexes(tachyon);
   RecalculateSelectedObjectsOrigin(tachyon);
 
   // Save when objects are copied
   SaveWorldData(tachyon, state);
 }
 
-static void MaybeSelectObject(Tachyon* tachyon) {
+static inline uint32 GetObjectKey(const tObject& object) {
+  return (uint32(object.mesh_index) << 16) | object.object_id;
+}
+
+static tBounds GetPickableObjectBounds(Tachyon* tachyon, const tObject& object) {
+  auto& mesh_radii = editor.pickable_mesh_radii;
+
+  if (mesh_radii.size() <= object.mesh_index) {
+    mesh_radii.resize(tachyon->mesh_pack.mesh_records.size(), -1.f);
+  }
+
+  // Mesh radii are computed once, when first needed
+  if (mesh_radii[object.mesh_index] < 0.f) {
+    auto mesh_bounds = Tachyon_GetMeshBounds(tachyon, object.mesh_index);
+
+    mesh_radii[object.mesh_index] = std::max(mesh_bounds.min.magnitude(), mesh_bounds.max.magnitude());
+  }
+
+  float scale = std::max(object.scale.x, std::max(object.scale.y, object.scale.z));
+
+  return Tachyon_GetSphereBounds(object.position, mesh_radii[object.mesh_index] * scale);
+}
+
+static void MaybeRebuildPickableObjectsBVH(Tachyon* tachyon) {
+  if (!editor.is_pickable_objects_bvh_dirty) {
+    return;
+  }
+
   auto& placeable_meshes = MeshLibrary::GetPlaceableMeshAssets();
-  auto& camera = tachyon->scene.camera;
-  auto forward = camera.orientation.getDirection();
-  float highest_candidate_score = 0.f;
-  tObject candidate;
+  auto& pickable_objects = editor.pickable_objects;
+  std::vector<tBounds> bounds;
+
+  pickable_objects.clear();
 
   for (auto& mesh : placeable_meshes) {
     auto& instances = objects(mesh.mesh_index);
@@ -600,14 +683,72 @@ static void MaybeSelectObject(Tachyon* tachyon) {
     }
 
     for (auto& object : instances) {
-      auto camera_to_object = object.position - camera.position;
-      auto object_dot = tVec3f::dot(forward, camera_to_object.unit());
-      auto distance = camera_to_object.magnitude();
-      auto scale_limit = std::clamp(object.scale.x * 3.f, 50000.f, 1000000.f);
+      pickable_objects.push_back(object);
+      bounds.push_back(GetPickableObjectBounds(tachyon, object));
+    }
+  }
+
+  Tachyon_BuildBVH(editor.pickable_objects_bvh, bounds);
+
+  editor.is_pickable_objects_bvh_dirty = false;
+}
 
-      if (distance > scale_limit || object_dot < 0.6f) continue;
+static float GetPickScore(Tachyon* tachyon, const tObject& object) {
+  auto& camera = tachyon->scene.camera;
+  auto forward = camera.orientation.getDirection();
+  auto camera_to_object = object.position - camera.position;
+  auto object_dot = tVec3f::dot(forward, camera_to_object.unit());
+  auto distance = camera_to_object.magnitude();
+  auto scale_limit = std::clamp(object.scale.x * 3.f, 50000.f, 1000000.f);
+
+  if (distance > scale_limit || object_dot < 0.6f) {
+    return 0.f;
+  }
+
+  return (100.f * powf(object_dot, 20.f)) / distance;
+}
+
+static void AddSelectedObject(Tachyon* tachyon, const tObject& object) {
+  for (auto& selected : editor.selected_objects) {
+    if (selected == object) {
+      return;
+    }
+  }
+
+  editor.selected_objects.push_back(object);
+
+  RefreshSelectedObjectIndexes(tachyon);
+  RecalculateSelectedObjectsOrigin(tachyon);
+}
+
+static void MaybeSelectObject(Tachyon* tachyon) {
+  auto& camera = tachyon->scene.camera;
+  auto& pickable_objects = editor.pickable_objects;
+  auto& candidates = editor.pick_candidates;
+  float highest_candidate_score = 0.f;
+  tObject candidate;
+
+  MaybeRebuildPickableObjectsBVH(tachyon);
 
-      auto score = (100.f * powf(object_dot, 20.f)) / distance;
+  // Prefer objects directly in front of the camera
+  candidates.clear();
+
+  Tachyon_QueryBVHRay(editor.pickable_objects_bvh, camera.position, camera.orientation.getDirection(), 1000000.f, candidates);
+
+  for (auto index : candidates) {
+    auto score = GetPickScore(tachyon, pickable_objects[index]);
+
+    if (score > highest_candidate_score) {
+      highest_candidate_score = score;
+      candidate = pickable_objects[index];
+    }
+  }
+
+  // Otherwise, fall back to whichever object is
+  // closest to the center of the view
+  if (highest_candidate_score == 0.f) {
+    for (auto& object : pickable_objects) {
+      auto score = GetPickScore(tachyon, object);
 
       if (score > highest_candidate_score) {
         highest_candidate_score = score;
@@ -618,29 +759,62 @@ static void MaybeSelectObject(Tachyon* tachyon) {
 
   if (highest_candidate_score > 0.f) {
     if (!is_key_held(tKey::ALT)) {
-      editor.selected_objects.clear();
+      ClearSelectedObjects();
     }
 
-    bool already_selected = false;
+    AddSelectedObject(tachyon, candidate);
 
-    for (auto& object : editor.selected_objects) {
-      if (candidate == object) {
-        already_selected = true;
-
-        break;
-      }
+    if (editor.selected_objects.size() > 1) {
+      editor.is_object_picker_active = false;
     }
+  }
+}
 
-    if (!already_selected) {
-      editor.selected_objects.push_back(candidate);
+/**
+ * Adds every placeable object overlapping the bounds
+ * of the current selection to the selection.
+ */
+static void SelectObjectsOverlappingSelection(Tachyon* tachyon) {
+  auto& pickable_objects = editor.pickable_objects;
+  auto& candidates = editor.pick_candidates;
+  auto selection_bounds = GetPickableObjectBounds(tachyon, GetSelectedObject(tachyon, 0));
 
-      RecalculateSelectedObjectsOrigin(tachyon);
-    }
+  for (size_t i = 1; i < editor.selected_objects.size(); i++) {
+    auto bounds = GetPickableObjectBounds(tachyon, GetSelectedObject(tachyon, i));
 
-    if (editor.selected_objects.size() > 1) {
-      editor.is_object_picker_active = false;
+    selection_bounds.min.x = std::min(selection_bounds.min.x, bounds.min.x);
+    selection_bounds.min.y = std::min(selection_bounds.min.y, bounds.min.y);
+    selection_bounds.min.z = std::min(selection_bounds.min.z, bounds.min.z);
+    selection_bounds.max.x = std::max(selection_bounds.max.x, bounds.max.x);
+    selection_bounds.max.y = std::max(selection_bounds.max.y, bounds.max.y);
+    selection_bounds.max.z = std::max(selection_bounds.max.z, bounds.max.z);
+  }
+
+  RestoreSelectedObjectColors(tachyon);
+  MaybeRebuildPickableObjectsBVH(tachyon);
+
+  candidates.clear();
+
+  Tachyon_QueryBVHBounds(editor.pickable_objects_bvh, selection_bounds, candidates);
+
+  std::unordered_set<uint32> selected_keys;
+
+  for (auto& object : editor.selected_objects) {
+    selected_keys.insert(GetObjectKey(object));
+  }
+
+  for (auto index : candidates) {
+    auto& object = pickable_objects[index];
+
+    if (selected_keys.insert(GetObjectKey(object)).second) {
+      editor.selected_objects.push_back(object);
     }
   }
+
+  editor.is_object_picker_active = false;
+
+  RefreshSelectedObjectIndexes(tachyon);
+  RecalculateSelectedObjectsOrigin(tachyon);
 }
 
 // @todo CTRL-Z (?)
@@ -688,7 +862,9 @@ static void HandleInputs(Tachyon* tachyon, State& state, const float dt) {
       }
 
       editor.is_object_picker_active = false;
-      editor.selected_objects.clear();
+      editor.is_pickable_objects_bvh_dirty = true;
+
+      ClearSelectedObjects();
 
       // Save when objects are deleted
       SaveWorldData(tachyon, state);
@@ -714,6 +890,11 @@ static void HandleInputs(Tachyon* tachyon, State& state, const float dt) {
     // @todo implement a color picker, or color controls
     if (did_press_key(tKey::J) && editor.selected_objects.size() == 1) {
       editor.selected_objects[0].color = tVec3f(1.f, 0.1f, 0.1f);
+      editor.should_commit_selected_objects = true;
+    }
+
+    if (did_press_key(tKey::B)) {
+      SelectObjectsOverlappingSelection(tachyon);
     }
   }
 
@@ -817,19 +998,31 @@ static void HandleInputs(Tachyon* tachyon, State& state, const float dt) {
 
 static void HandleSelectedObjects(Tachyon* tachyon, State& state) {
   auto& camera = tachyon->scene.camera;
-  auto& first_selected = *get_live_object(editor.selected_objects[0]);
+  auto& first_selected = GetSelectedObject(tachyon, 0);
   bool should_flash = uint32(tachyon->running_time * 2.f) % 2;
 
-  for (auto& object : editor.selected_objects) {
-    auto& selected = *get_live_object(object);
+  // Only recommit the selection when it has been changed,
+  // or when it toggles between flashing/not flashing
+  if (editor.should_commit_selected_objects || should_flash != editor.was_selection_flashing) {
+    auto start_time = Tachyon_GetMicroseconds();
 
-    selected.color = object.color;
-    selected.color.rgba &= should_flash ? 0xF0F0 : 0xFFF0;
-    selected.color.rgba |= should_flash ? 0x0006 : 0x0001;
+    for (size_t i = 0; i < editor.selected_objects.size(); i++) {
+      auto& selected = GetSelectedObject(tachyon, i);
 
-    commit(selected);
+      selected.color = editor.selected_objects[i].color;
+      selected.color.rgba &= should_flash ? 0xF0F0 : 0xFFF0;
+      selected.color.rgba |= should_flash ? 0x0006 : 0x0001;
+
+      commit(selected);
+    }
+
+    editor.should_commit_selected_objects = false;
+    editor.was_selection_flashing = should_flash;
+    editor.last_selection_update_time = Tachyon_GetMicroseconds() - start_time;
   }
 
+  add_dev_label("Selection update", std::format("{} objects, {}us", editor.selected_objects.size(), editor.last_selection_update_time));
+
   // @todo refactor
   {
     objects(state.meshes.editor_position).disabled = true;
@@ -892,7 +1085,8 @@ static void HandleSelectedObjects(Tachyon* tachyon, State& state) {
     RestoreSelectedObjectColors(tachyon);
 
     editor.is_object_picker_active = false;
-    editor.selected_objects.clear();
+
+    ClearSelectedObjects();
 
     // Save when deselecting an object
     SaveWorldData(tachyon, state);
@@ -1088,10 +1282,16 @@ void Editor::EnableEditor(Tachyon* tachyon, State& state) {
 
   objects(state.meshes.editor_guideline).disabled = false;
 
+  editor.is_pickable_objects_bvh_dirty = true;
+
   DisableGeneratedMeshes(tachyon);
   EnablePlaceholderMeshes(tachyon);
   ResetInitialObjects(tachyon);
 
+  // Objects may have been reordered within their groups while
+  // the editor was disabled, e.g. by level of detail partitioning
+  RefreshSelectedObjectIndexes(tachyon);
+
   tachyon->show_developer_tools = true;
   tachyon->use_high_visibility_mode = true;
 
@@ -1121,7 +1321,7 @@ void Editor::DisableEditor(Tachyon* tachyon, State& state) {
 
   // Reset target trackers to avoid stale references
   // if objects are deleted in the editor
-  state.on_screen_target_trackers.clear();
+  TargetSystem::ResetTargetTrackers(state);
 
   state.is_editor_active = false;
 
@@ -2,6 +2,8 @@
 
 #define USE_PROCEDURAL_GENERATION 1
 
+#include <unordered_map>
+
 #include "engine/tachyon.h"
 #include "cosmodrone/mesh_ids.h"
 
@@ -60,15 +62,44 @@ namespace Cosmodrone {
 
   struct VehicleNetworkNode {
     tVec3f position;
-    std::vector<VehicleNetworkNode> connected_nodes;
+    std::vector<uint32> connected_node_indexes;
+  };
+
+  // A straight path between two vehicle targets, with its
+  // orientation precomputed once when it is created
+  struct VehicleRoute {
+    tVec3f start;
+    tVec3f direction;
+    float length = 0.f;
+    Quaternion rotation = Quaternion(1.f, 0, 0, 0);
+    // Flying ship running lights, relative to the ship position
+    tVec3f light_offset_1;
+    tVec3f light_offset_2;
   };
 
-  struct BackgroundVehicle {
+  enum BackgroundVehicleType : uint8 {
+    FLYING_SHIP,
+    CARGO_FERRY
+  };
+
+  // All background vehicles, stored as parallel arrays. Vehicles
+  // are moved along their routes by distance, and their parts
+  // are stored contiguously in parts.
+  struct VehicleTraffic {
+    std::vector<VehicleRoute> routes;
+
+    std::vector<uint8> types;
+    std::vector<uint32> route_indexes;
+    std::vector<tVec3f> offsets;
+    std::vector<float> distances;
+    std::vector<float> speeds;
+    std::vector<uint32> parts_offsets;
+    std::vector<uint8> total_parts;
+    std::vector<uint32> light_indexes_offsets;
+
     std::vector<tObject> parts;
-    tVec3f spawn_position;
-    tVec3f target_position;
-    float speed = 0.f;
-    uint32 light_indexes_offset = 0;
+
+    uint32 update_cycle = 0;
   };
 
   struct PilotableVehicle {
@@ -90,21 +121,48 @@ namespace Cosmodrone {
     float spawn_time = 0.f;
   };
 
-  struct BlinkingLight {
-    tObject bulb;
-    uint32 light_index;
+  // World geometry which bullets and missiles can hit
+  struct ProjectileCollider {
+    tObject object;
+    tBounds local_bounds;
   };
 
-  // @todo handle multiple moving lights per object
-  struct MovingLight {
-    tObject light_object;
+  enum LightAnimationFlags : uint8 {
+    // Power follows pulse_power * (0.5 * sin(t * pulse_rate + pulse_phase) + 0.5)^pulse_exponent
+    LIGHT_PULSES = 1 << 0,
+    // Positioned at the object, plus its offset rotated into object space
+    LIGHT_FOLLOWS_OBJECT = 1 << 1,
+    LIGHT_OFFSET_SCALES_WITH_OBJECT = 1 << 2,
+    // The object's color is set to tint_color, with the light's power as alpha
+    LIGHT_TINTS_OBJECT = 1 << 3
+  };
+
+  // Describes a single animated light, when adding it to LightAnimations
+  struct LightAnimation {
     uint32 light_index = 0;
+    uint8 flags = 0;
+    tObject object;
+    tVec3f offset;
+    float pulse_phase = 0.f;
+    float pulse_rate = 0.f;
+    float pulse_power = 1.f;
+    float pulse_exponent = 1.f;
+    tVec3f tint_color;
   };
 
-  struct SolarRotatorLight {
-    tObject rotator;
-    uint32 light_index_1 = 0;
-    uint32 light_index_2 = 0;
+  // Animation parameters for all animated point lights,
+  // stored as parallel arrays so every light can be
+  // updated in a single pass
+  struct LightAnimations {
+    std::vector<uint32> light_indexes;
+    std::vector<uint8> flags;
+    std::vector<tObject> objects;
+    std::vector<tVec3f> offsets;
+    std::vector<float> pulse_phases;
+    std::vector<float> pulse_rates;
+    std::vector<float> pulse_powers;
+    std::vector<float> pulse_exponents;
+    std::vector<tVec3f> tint_colors;
   };
 
   struct State {
@@ -158,6 +216,15 @@ namespace Cosmodrone {
 
     TargetStats target_stats;
     std::vector<TargetTracker> on_screen_target_trackers;
+    // Indexes into on_screen_target_trackers, keyed by mesh index + object ID
+    std::unordered_map<uint32, uint32> target_tracker_indexes;
+    // Targetable objects which never move are indexed once,
+    // and moving ones are tested in place every frame
+    tSpatialGrid stationary_target_grid;
+    std::vector<tObject> stationary_targets;
+    std::vector<uint32> target_candidates;
+    uint32 total_indexed_stationary_targets = 0;
+    bool should_reindex_stationary_targets = true;
 
     uint8 flight_arrow_cycle_step = 0;
     float flight_path_spawn_distance_remaining = 100.f;
@@ -165,21 +232,22 @@ namespace Cosmodrone {
 
     std::vector<Beacon> beacons;
 
-    std::vector<uint32> gas_flare_light_indexes;
-    std::vector<BlinkingLight> blinking_lights;
-    std::vector<MovingLight> moving_lights;
-    std::vector<SolarRotatorLight> solar_rotator_lights;
+    LightAnimations light_animations;
 
     std::vector<VehicleNetworkNode> vehicle_network;
-    std::vector<BackgroundVehicle> vehicles;
+    VehicleTraffic vehicle_traffic;
 
     std::vector<PilotableVehicle> pilotable_vehicles;
     PilotableVehicle current_piloted_vehicle;
 
     std::vector<Bullet> machine_gun_bullets;
     std::vector<Bullet> missiles;
-    uint16 next_machine_gun_bullet_index = 0;
-    uint16 next_missile_index = 0;
+    float last_machine_gun_fire_time = 0.f;
+    float last_missile_fire_time = 0.f;
+
+    std::vector<ProjectileCollider> projectile_colliders;
+    tBVH projectile_collider_bvh;
+    std::vector<uint32> projectile_hit_candidates;
 
     FlightSystem flight_system = FlightSystem::DRONE;
     bool is_piloting_vehicle = false;
@@ -42,6 +42,39 @@ static void AddStaticLights(Tachyon* tachyon, State& state) {
   }
 }
 
+// Animated lights further than this from the camera keep
+// their last state, and aren't updated until they come back
+// into range
+constexpr static float LIGHT_ANIMATION_DISTANCE = 1000000.f;
+
+static void AddLightAnimation(State& state, const LightAnimation& animation) {
+  auto& animations = state.light_animations;
+
+  animations.light_indexes.push_back(animation.light_index);
+  animations.flags.push_back(animation.flags);
+  animations.objects.push_back(animation.object);
+  animations.offsets.push_back(animation.offset);
+  animations.pulse_phases.push_back(animation.pulse_phase);
+  animations.pulse_rates.push_back(animation.pulse_rate);
+  animations.pulse_powers.push_back(animation.pulse_power);
+  animations.pulse_exponents.push_back(animation.pulse_exponent);
+  animations.tint_colors.push_back(animation.tint_color);
+}
+
+static void ClearLightAnimations(State& state) {
+  auto& animations = state.light_animations;
+
+  animations.light_indexes.clear();
+  animations.flags.clear();
+  animations.objects.clear();
+  animations.offsets.clear();
+  animations.pulse_phases.clear();
+  animations.pulse_rates.clear();
+  animations.pulse_powers.clear();
+  animations.pulse_exponents.clear();
+  animations.tint_colors.clear();
+}
+
 static void AddBlinkingLights(Tachyon* tachyon, State& state) {
   auto& point_lights = tachyon->point_lights;
 
@@ -49,16 +82,24 @@ static void AddBlinkingLights(Tachyon* tachyon, State& state) {
     tVec3f offset = bulb.rotation.toMatrix4f() * tVec3f(0.f, 0.1f, 0);
     offset *= bulb.scale;
 
+    tVec3f position = bulb.position + offset;
+
     point_lights.push_back({
-      .position = bulb.position + offset,
+      .position = position,
       .radius = 5000.f,
       .color = tVec3f(1.f, 0.6f, 0.2f),
       .power = 1.f
     });
 
-    state.blinking_lights.push_back({
-      .bulb = bulb,
-      .light_index = uint32(point_lights.size() - 1)
+    AddLightAnimation(state, {
+      .light_index = uint32(point_lights.size() - 1),
+      .flags = LIGHT_PULSES | LIGHT_TINTS_OBJECT,
+      .object = bulb,
+      .pulse_phase = position.x * 0.03f,
+      .pulse_rate = 3.f,
+      .pulse_power = 1.f,
+      .pulse_exponent = 5.f,
+      .tint_color = tVec3f(1.f, 0.5f, 0.2f)
     });
   }
 }
@@ -74,9 +115,12 @@ static void AddMovingLights(Tachyon* tachyon, State& state) {
       .power = 1.f
     });
 
-    state.moving_lights.push_back({
-      .light_object = light,
-      .light_index = uint32(point_lights.size() - 1)
+    AddLightAnimation(state, {
+      .light_index = uint32(point_lights.size() - 1),
+      .flags = LIGHT_FOLLOWS_OBJECT,
+      .object = light,
+      // Along the forward direction
+      .offset = tVec3f(0, 0, -1500.f)
     });
   }
 
@@ -88,9 +132,11 @@ static void AddMovingLights(Tachyon* tachyon, State& state) {
       .power = 1.f
     });
 
-    state.moving_lights.push_back({
-      .light_object = light,
-      .light_index = uint32(point_lights.size() - 1)
+    AddLightAnimation(state, {
+      .light_index = uint32(point_lights.size() - 1),
+      .flags = LIGHT_FOLLOWS_OBJECT,
+      .object = light,
+      .offset = tVec3f(0, 1.f, -0.5f) * 3400.f
     });
   }
 }
@@ -99,15 +145,24 @@ static void AddGasFlareLights(Tachyon* tachyon, State& state) {
   auto& point_lights = tachyon->point_lights;
 
   for (auto& flare : objects(state.meshes.gas_flare_1_spawn)) {
+    // @todo @fix this repositioning breaks light syncing
+    tVec3f position = flare.position - flare.rotation.getUpDirection() * flare.scale.y * 0.9f;
+
     point_lights.push_back({
-      // @todo @fix this repositioning breaks light syncing
-      .position = flare.position - flare.rotation.getUpDirection() * flare.scale.y * 0.9f,
+      .position = position,
       .radius = 40000.f,
       .color = tVec3f(1.f, 0.5f, 0.1f),
       .power = 3.f
     });
 
-    state.gas_flare_light_indexes.push_back(point_lights.size() - 1);
+    AddLightAnimation(state, {
+      .light_index = uint32(point_lights.size() - 1),
+      .flags = LIGHT_PULSES,
+      .pulse_phase = position.x,
+      .pulse_rate = 0.5f,
+      .pulse_power = 5.f,
+      .pulse_exponent = 1.f
+    });
   }
 }
 
@@ -115,98 +170,29 @@ static void AddSolarRotatorLights(Tachyon* tachyon, State& state) {
   auto& point_lights = tachyon->point_lights;
 
   for (auto& rotator : objects(state.meshes.solar_rotator_2_body)) {
-    point_lights.push_back({
-      .position = rotator.position,
-      .radius = 30000.f,
-      .color = tVec3f(1.f, 0, 0),
-      .power = 3.f
-    });
-
-    point_lights.push_back({
-      .position = rotator.position,
-      .radius = 30000.f,
-      .color = tVec3f(1.f, 0, 0),
-      .power = 3.f
-    });
-
-    state.solar_rotator_lights.push_back({
-      .rotator = rotator,
-      .light_index_1 = uint32(point_lights.size() - 2),
-      .light_index_2 = uint32(point_lights.size() - 1)
-    });
-  }
-}
-
-static void UpdateBlinkingLights(Tachyon* tachyon, State& state) {
-  for (auto& blinking_light : state.blinking_lights) {
-    auto& light = tachyon->point_lights[blinking_light.light_index];
-    auto& bulb = *get_live_object(blinking_light.bulb);
-    auto power = 0.5f * sinf(state.current_game_time * 3.f + light.position.x * 0.03f) + 0.5f;
-    power = powf(power, 5.f);
-
-    light.power = power;
-    bulb.color = tVec4f(1.f, 0.5f, 0.2f, power);
-
-    commit(bulb);
-  }
-}
-
-// @todo handle multiple moving lights per object
-static void UpdateMovingLights(Tachyon* tachyon, State& state) {
-  for (auto& moving_light : state.moving_lights) {
-    auto& light = tachyon->point_lights[moving_light.light_index];
-    auto& bulb = *get_live_object(moving_light.light_object);
-
-    light.position = bulb.position;
-
-    if (bulb.mesh_index == state.meshes.station_drone_light) {
-      // @optimize
-      light.position = bulb.position + bulb.rotation.getDirection() * 1500.f;
-    }
-
-    if (bulb.mesh_index == state.meshes.procedural_elevator_car_light) {
-      // @optimize
-      light.position =
-        bulb.position +
-        bulb.rotation.toMatrix4f() * (tVec3f(0, 1.f, -0.5f) * 3400.f);
+    // One light at either end of the rotator
+    for (float side : { 1.f, -1.f }) {
+      point_lights.push_back({
+        .position = rotator.position,
+        .radius = 30000.f,
+        .color = tVec3f(1.f, 0, 0),
+        .power = 3.f
+      });
+
+      AddLightAnimation(state, {
+        .light_index = uint32(point_lights.size() - 1),
+        .flags = LIGHT_FOLLOWS_OBJECT | LIGHT_OFFSET_SCALES_WITH_OBJECT,
+        .object = rotator,
+        .offset = tVec3f(0, 0, side * 2.625f)
+      });
     }
   }
 }
 
-static void UpdateGasFlareLights(Tachyon* tachyon, State& state) {
-  for (auto light_index : state.gas_flare_light_indexes) {
-    auto& light = tachyon->point_lights[light_index];
-    auto t = state.current_game_time * 0.5f + light.position.x;
-    auto power = 5.f * (0.5f * sinf(t) + 0.5f);
-
-    light.power = power;
-  }
-}
-
-static void UpdateSolarRotatorLights(Tachyon* tachyon, State& state) {
-  for (auto& lights : state.solar_rotator_lights) {
-    auto& rotator = *get_live_object(lights.rotator);
-    auto matrix = rotator.rotation.toMatrix4f();
-    auto& light_1 = tachyon->point_lights[lights.light_index_1];
-    auto& light_2 = tachyon->point_lights[lights.light_index_2];
-
-    light_1.position =
-      rotator.position +
-      matrix * (rotator.scale * tVec3f(0, 0, 1.f) * 2.625f);
-
-    light_2.position =
-      rotator.position +
-      matrix * (rotator.scale * tVec3f(0, 0, -1.f) * 2.625f);
-  }
-}
-
 void Lights::InitLights(Tachyon* tachyon, State& state) {
   auto& point_lights = tachyon->point_lights;
 
-  state.gas_flare_light_indexes.clear();
-  state.blinking_lights.clear();
-  state.moving_lights.clear();
-  state.solar_rotator_lights.clear();
+  ClearLightAnimations(state);
 
   // @todo only clear generated lights
   tachyon->point_lights.clear();
@@ -218,9 +204,52 @@ void Lights::InitLights(Tachyon* tachyon, State& state) {
   AddSolarRotatorLights(tachyon, state);
 }
 
+/**
+ * ----------------------------
+ * Updates all animated lights in one pass over the light
+ * animation arrays, skipping lights far from the camera.
+ * ----------------------------
+ */
 void Lights::UpdateLights(Tachyon* tachyon, State& state) {
-  UpdateBlinkingLights(tachyon, state);
-  UpdateMovingLights(tachyon, state);
-  UpdateGasFlareLights(tachyon, state);
-  UpdateSolarRotatorLights(tachyon, state);
+  auto& animations = state.light_animations;
+  auto& camera_position = tachyon->scene.camera.position;
+  auto t = state.current_game_time;
+
+  for (size_t i = 0; i < animations.light_indexes.size(); i++) {
+    auto& light = tachyon->point_lights[animations.light_indexes[i]];
+    auto flags = animations.flags[i];
+
+    if (flags & LIGHT_FOLLOWS_OBJECT) {
+      auto& object = *get_live_object(animations.objects[i]);
+
+      if ((object.position - camera_position).magnitude() > LIGHT_ANIMATION_DISTANCE) {
+        continue;
+      }
+
+      tVec3f offset = animations.offsets[i];
+
+      if (flags & LIGHT_OFFSET_SCALES_WITH_OBJECT) {
+        offset = object.scale * offset;
+      }
+
+      light.position = object.position + object.rotation.toMatrix4f() * offset;
+    } else if ((light.position - camera_position).magnitude() > LIGHT_ANIMATION_DISTANCE) {
+      continue;
+    }
+
+    if (flags & LIGHT_PULSES) {
+      auto power = 0.5f * sinf(t * animations.pulse_rates[i] + animations.pulse_phases[i]) + 0.5f;
+
+      light.power = animations.pulse_powers[i] * powf(power, animations.pulse_exponents[i]);
+    }
+
+    if (flags & LIGHT_TINTS_OBJECT) {
+      auto& object = *get_live_object(animations.objects[i]);
+      auto& tint = animations.tint_colors[i];
+
+      object.color = tVec4f(tint.x, tint.y, tint.z, light.power);
+
+      commit(object);
+    }
+  }
 }
\ No newline at end of file
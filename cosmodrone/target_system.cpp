@@ -8,17 +8,17 @@ using namespace Cosmodrone;
 
 const static float MAX_TARGET_DISTANCE = 400000.f;
 
-static bool IsTrackingObject(State& state, const tObject& object) {
-  for (auto& tracker : state.on_screen_target_trackers) {
-    if (tracker.object == object) {
-      return true;
-    }
-  }
+static inline uint32 GetTrackerKey(const tObject& object) {
+  return (uint32(object.mesh_index) << 16) | uint32(object.object_id);
+}
 
-  return false;
+static bool IsTrackingObject(State& state, const tObject& object) {
+  return state.target_tracker_indexes.find(GetTrackerKey(object)) != state.target_tracker_indexes.end();
 }
 
 static void StartTrackingObject(State& state, const tObject& object) {
+  state.target_tracker_indexes[GetTrackerKey(object)] = (uint32)state.on_screen_target_trackers.size();
+
   state.on_screen_target_trackers.push_back({
     .object = object,
     .activated_time = state.current_game_time,
@@ -30,15 +30,26 @@ static void StartTrackingObject(State& state, const tObject& object) {
 
 static void StopTrackingObject(State& state, const tObject& object) {
   auto& trackers = state.on_screen_target_trackers;
+  auto& indexes = state.target_tracker_indexes;
+  auto entry = indexes.find(GetTrackerKey(object));
+
+  if (entry == indexes.end()) {
+    return;
+  }
 
-  for (uint32 i = 0; i < trackers.size(); i++) {
-    if (trackers[i].object == object) {
-      trackers.erase(trackers.begin() + i);
+  uint32 index = entry->second;
+  uint32 last_index = (uint32)trackers.size() - 1;
 
-      return;
-    }
+  indexes.erase(entry);
+
+  // Swap the last tracker into the removed tracker's place
+  if (index != last_index) {
+    trackers[index] = trackers[last_index];
+    indexes[GetTrackerKey(trackers[index].object)] = index;
   }
 
+  trackers.pop_back();
+
   // @todo
   // for (auto& tracker : state.on_screen_target_trackers) {
   //   if (tracker.object == object) {
@@ -49,65 +60,211 @@ static void StopTrackingObject(State& state, const tObject& object) {
   // }
 }
 
+/**
+ * ----------------------------
+ * Determines whether objects of a targetable mesh stay put,
+ * so they only need to be indexed once.
+ * ----------------------------
+ */
+static bool IsStationaryTargetMesh(State& state, const uint16 mesh_index) {
+  auto& meshes = state.meshes;
+
+  return (
+    mesh_index == meshes.antenna_3 ||
+    mesh_index == meshes.antenna_5 ||
+    mesh_index == meshes.charge_pad ||
+    mesh_index == meshes.floater_1
+  );
+}
+
+static bool IsInTargetingCone(const tVec3f& camera_position, const tVec3f& forward_direction, const tVec3f& position) {
+  tVec3f offset = position - camera_position;
+  float distance = offset.magnitude();
+
+  return (
+    distance <= MAX_TARGET_DISTANCE &&
+    (distance == 0.f || tVec3f::dot(forward_direction, offset) >= 0.7f * distance)
+  );
+}
+
+static void IndexStationaryTargets(Tachyon* tachyon, State& state) {
+  auto& targets = state.stationary_targets;
+  auto& grid = state.stationary_target_grid;
+
+  // @allocation
+  std::vector<tVec3f> positions;
+
+  targets.clear();
+
+  for (auto mesh_index : Utilities::GetTargetableMeshes(state)) {
+    if (!IsStationaryTargetMesh(state, mesh_index)) continue;
+
+    for (auto& object : objects(mesh_index)) {
+      targets.push_back(object);
+      positions.push_back(object.position);
+    }
+  }
+
+  // The station extends as far vertically as it does horizontally,
+  // so divide cells along y too. Cells are well below the query
+  // radius, so a query only visits cells which mostly overlap
+  // the targeting cone.
+  grid.use_vertical_cells = true;
+
+  Tachyon_BuildSpatialGrid(grid, positions, MAX_TARGET_DISTANCE / 4.f);
+}
+
+/**
+ * ----------------------------
+ * Re-indexes stationary targets when they have been added
+ * or removed, or when requested (e.g. after editing the world).
+ * ----------------------------
+ */
+static void MaybeIndexStationaryTargets(Tachyon* tachyon, State& state) {
+  uint32 total_stationary_targets = 0;
+
+  for (auto mesh_index : Utilities::GetTargetableMeshes(state)) {
+    if (IsStationaryTargetMesh(state, mesh_index)) {
+      total_stationary_targets += objects(mesh_index).total_active;
+    }
+  }
+
+  if (
+    state.should_reindex_stationary_targets ||
+    total_stationary_targets != state.total_indexed_stationary_targets
+  ) {
+    IndexStationaryTargets(tachyon, state);
+
+    state.total_indexed_stationary_targets = total_stationary_targets;
+    state.should_reindex_stationary_targets = false;
+  }
+}
+
+/**
+ * ----------------------------
+ * Starts tracking any untracked stationary targets which
+ * are within range and in front of the camera.
+ * ----------------------------
+ */
+static void TrackStationaryTargetsInView(Tachyon* tachyon, State& state) {
+  auto& camera = tachyon->scene.camera;
+  auto& candidates = state.target_candidates;
+
+  Tachyon_QuerySpatialGridCone(state.stationary_target_grid, camera.position, state.view_forward_direction, MAX_TARGET_DISTANCE, 0.7f, candidates);
+
+  for (auto index : candidates) {
+    auto& object = state.stationary_targets[index];
+
+    if (state.is_piloting_vehicle && object == state.docking_target) {
+      continue;
+    }
+
+    if (!IsTrackingObject(state, object)) {
+      StartTrackingObject(state, object);
+    }
+  }
+}
+
+/**
+ * ----------------------------
+ * Starts tracking any untracked moving targets which are
+ * within range and in front of the camera. Indexing moving
+ * targets would mean rebuilding an index every frame for a
+ * single query, so they are tested in place instead.
+ * ----------------------------
+ */
+static void TrackMovingTargetsInView(Tachyon* tachyon, State& state) {
+  auto& camera = tachyon->scene.camera;
+
+  for (auto mesh_index : Utilities::GetTargetableMeshes(state)) {
+    if (IsStationaryTargetMesh(state, mesh_index)) continue;
+
+    for (auto& object : objects(mesh_index)) {
+      if (!IsInTargetingCone(camera.position, state.view_forward_direction, object.position)) {
+        continue;
+      }
+
+      if (state.is_piloting_vehicle && object == state.docking_target) {
+        continue;
+      }
+
+      if (!IsTrackingObject(state, object)) {
+        StartTrackingObject(state, object);
+      }
+    }
+  }
+}
+
 void TargetSystem::HandleTargetTrackers(Tachyon* tachyon, State& state, const float dt) {
   auto& scene = tachyon->scene;
   auto& camera = scene.camera;
 
   // Manage tracker instances
   {
-    auto& targetable_meshes = Utilities::GetTargetableMeshes(state);
+    auto& trackers = state.on_screen_target_trackers;
+
+    // Stop tracking objects which have left the view,
+    // going backwards so removals don't skip trackers
+    for (int32 i = (int32)trackers.size() - 1; i >= 0; i--) {
+      tObject* live_object = get_live_object(trackers[i].object);
 
-    for (auto mesh_index : targetable_meshes) {
-      for (auto& object : objects(mesh_index)) {
-        auto camera_to_object = object.position - camera.position;
-        auto object_direction = camera_to_object.unit();
-        auto target_dot = tVec3f::dot(object_direction, state.view_forward_direction);
+      if (live_object == nullptr) {
+        StopTrackingObject(state, trackers[i].object);
+
+        continue;
+      }
 
+      auto& object = *live_object;
+      auto camera_to_object = object.position - camera.position;
+      auto object_direction = camera_to_object.unit();
+      auto target_dot = tVec3f::dot(object_direction, state.view_forward_direction);
+
+      if (object.mesh_index == state.meshes.zone_target) {
         if (
-          camera_to_object.magnitude() > MAX_TARGET_DISTANCE ||
-          (state.is_piloting_vehicle && object == state.docking_target) ||
+          camera_to_object.magnitude() > 5000000.f ||
           target_dot < 0.7f
         ) {
-          if (
-            IsTrackingObject(state, object) &&
-            // Perform a special check to avoid un-tracking docking targets
-            // when they go offscreen while auto-docking, provided they are
-            // still technically in front of the camera.
-            !(
-              state.flight_mode == FlightMode::AUTO_DOCK &&
-              object == state.docking_target &&
-              target_dot > 0.f
-            )
-          ) {
-            StopTrackingObject(state, object);
-          }
-
-          continue;
+          StopTrackingObject(state, object);
         }
 
-        if (!IsTrackingObject(state, object)) {
-          StartTrackingObject(state, object);
-        }
+        continue;
+      }
+
+      if (
+        (
+          camera_to_object.magnitude() > MAX_TARGET_DISTANCE ||
+          (state.is_piloting_vehicle && object == state.docking_target) ||
+          target_dot < 0.7f
+        ) &&
+        // Perform a special check to avoid un-tracking docking targets
+        // when they go offscreen while auto-docking, provided they are
+        // still technically in front of the camera.
+        !(
+          state.flight_mode == FlightMode::AUTO_DOCK &&
+          object == state.docking_target &&
+          target_dot > 0.f
+        )
+      ) {
+        StopTrackingObject(state, object);
       }
     }
 
+    // Start tracking objects which have entered the view
+    MaybeIndexStationaryTargets(tachyon, state);
+
+    TrackStationaryTargetsInView(tachyon, state);
+    TrackMovingTargetsInView(tachyon, state);
+
     for (auto& object : objects(state.meshes.zone_target)) {
       auto camera_to_object = object.position - camera.position;
       auto object_direction = camera_to_object.unit();
       auto target_dot = tVec3f::dot(object_direction, state.view_forward_direction);
 
       if (
-        camera_to_object.magnitude() > 5000000.f ||
-        target_dot < 0.7f
+        camera_to_object.magnitude() <= 5000000.f &&
+        target_dot >= 0.7f &&
+        !IsTrackingObject(state, object)
       ) {
-        if (IsTrackingObject(state, object)) {
-          StopTrackingObject(state, object);
-        }
-
-        continue;
-      }
-
-      if (!IsTrackingObject(state, object)) {
         StartTrackingObject(state, object);
       }
     }
@@ -353,6 +510,12 @@ void TargetSystem::UpdateTargetStats(Tachyon* tachyon, State& state) {
   stats.relative_velocity = state.ship_velocity.magnitude() / 1000.f;
 }
 
+void TargetSystem::ResetTargetTrackers(State& state) {
+  state.on_screen_target_trackers.clear();
+  state.target_tracker_indexes.clear();
+  state.should_reindex_stationary_targets = true;
+}
+
 const TargetTracker* TargetSystem::GetSelectedTargetTracker(State& state) {
   for (auto& tracker : state.on_screen_target_trackers) {
     if (tracker.selected_time != 0.f) {
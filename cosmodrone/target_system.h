@@ -7,6 +7,7 @@ namespace Cosmodrone {
   namespace TargetSystem {
     void HandleTargetTrackers(Tachyon* tachyon, State& state, const float dt);
     void UpdateTargetStats(Tachyon* tachyon, State& state);
+    void ResetTargetTrackers(State& state);
     const TargetTracker* GetSelectedTargetTracker(State& state);
   };
 }
\ No newline at end of file
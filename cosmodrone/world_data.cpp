@@ -0,0 +1,220 @@
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "cosmodrone/mesh_library.h"
+#include "cosmodrone/world_data.h"
+
+using namespace Cosmodrone;
+
+/**
+ * Binary world data layout:
+ *
+ *  header:  "CDWD" | uint32 version | uint32 total blocks
+ *  block:   uint16 mesh name length | mesh name | uint32 total objects | objects
+ *  object:  float[3] position | float[4] rotation (w, x, y, z) | uint16 color | uint16 (unused)
+ *
+ * Blocks are keyed by mesh name rather than mesh index,
+ * since mesh indexes change as meshes are added.
+ */
+constexpr static char WORLD_DATA_MAGIC[4] = { 'C', 'D', 'W', 'D' };
+constexpr static uint32 WORLD_DATA_VERSION = 1;
+
+struct WorldObjectRecord {
+  float position[3];
+  float rotation[4];
+  uint16 color;
+  uint16 unused;
+};
+
+static_assert(sizeof(WorldObjectRecord) == 32);
+
+struct WorldDataBlock {
+  const MeshAsset* mesh_asset = nullptr;
+  const char* records = nullptr;
+  uint32 total_objects = 0;
+  uint16 start_index = 0;
+};
+
+template<typename T>
+static inline void Write(std::string& data, const T& value) {
+  data.append((const char*)&value, sizeof(T));
+}
+
+template<typename T>
+static inline bool Read(const std::string& data, size_t& offset, T& value) {
+  if (offset + sizeof(T) > data.size()) {
+    return false;
+  }
+
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+
+  offset += sizeof(T);
+
+  return true;
+}
+
+static const MeshAsset* GetMeshAssetByName(const std::string& mesh_name) {
+  auto& assets = MeshLibrary::GetPlaceableMeshAssets();
+
+  for (auto& asset : assets) {
+    if (asset.mesh_name == mesh_name) {
+      return &asset;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * Reads the block headers of the world data, without decoding any
+ * objects. Returns false if the data is not valid world data.
+ */
+static bool ReadWorldDataBlocks(const std::string& data, std::vector<WorldDataBlock>& blocks) {
+  size_t offset = 0;
+  char magic[4];
+  uint32 version;
+  uint32 total_blocks;
+
+  if (
+    !Read(data, offset, magic) ||
+    !Read(data, offset, version) ||
+    !Read(data, offset, total_blocks) ||
+    std::memcmp(magic, WORLD_DATA_MAGIC, 4) != 0 ||
+    version != WORLD_DATA_VERSION
+  ) {
+    return false;
+  }
+
+  for (uint32 i = 0; i < total_blocks; i++) {
+    uint16 name_length;
+    uint32 total_objects;
+
+    if (!Read(data, offset, name_length) || offset + name_length > data.size()) {
+      return false;
+    }
+
+    auto mesh_name = data.substr(offset, name_length);
+
+    offset += name_length;
+
+    if (!Read(data, offset, total_objects) || offset + total_objects * sizeof(WorldObjectRecord) > data.size()) {
+      return false;
+    }
+
+    WorldDataBlock block;
+    block.mesh_asset = GetMeshAssetByName(mesh_name);
+    block.records = data.data() + offset;
+    block.total_objects = total_objects;
+
+    offset += total_objects * sizeof(WorldObjectRecord);
+
+    if (block.mesh_asset == nullptr) {
+      printf("[LoadBinaryWorldData] Skipping objects for unknown mesh: %s\n", mesh_name.c_str());
+
+      continue;
+    }
+
+    blocks.push_back(block);
+  }
+
+  return true;
+}
+
+/**
+ * Writes the placeable objects of every mesh as a packed block.
+ */
+void WorldData::SaveBinaryWorldData(Tachyon* tachyon, const std::string& path) {
+  auto& placeable_meshes = MeshLibrary::GetPlaceableMeshAssets();
+  std::string data;
+
+  data.append(WORLD_DATA_MAGIC, 4);
+  Write(data, WORLD_DATA_VERSION);
+  Write(data, uint32(placeable_meshes.size()));
+
+  for (auto& mesh : placeable_meshes) {
+    auto& instances = objects(mesh.mesh_index);
+
+    Write(data, uint16(mesh.mesh_name.size()));
+    data.append(mesh.mesh_name);
+    Write(data, uint32(instances.total_active));
+
+    // Match the object order of the text world data
+    for (uint16 id = 0; id <= instances.highest_used_id; id++) {
+      tObject* instance = instances.getById(id);
+
+      if (instance != nullptr) {
+        auto& p = instance->position;
+        auto& r = instance->rotation;
+
+        WorldObjectRecord record = {
+          { p.x, p.y, p.z },
+          { r.w, r.x, r.y, r.z },
+          instance->color.rgba,
+          0
+        };
+
+        Write(data, record);
+      }
+    }
+  }
+
+  Tachyon_WriteBinaryFileContents(path, data);
+}
+
+/**
+ * Loads binary world data written by SaveBinaryWorldData(). Objects
+ * are created up front, and each mesh block is then decoded in
+ * parallel straight into its object group. Returns false if the
+ * file is missing or invalid, so text world data can be used instead.
+ */
+bool WorldData::LoadBinaryWorldData(Tachyon* tachyon, const std::string& path) {
+  auto start_time = Tachyon_GetMicroseconds();
+  auto data = Tachyon_GetBinaryFileContents(path.c_str());
+  std::vector<WorldDataBlock> blocks;
+
+  if (!ReadWorldDataBlocks(data, blocks)) {
+    console_log("Invalid binary world data: " + path);
+
+    return false;
+  }
+
+  // Creating objects may grow their object groups,
+  // so this must happen before decoding any blocks
+  for (auto& block : blocks) {
+    auto mesh_index = block.mesh_asset->mesh_index;
+
+    block.start_index = objects(mesh_index).total_active;
+
+    for (uint32 i = 0; i < block.total_objects; i++) {
+      create(mesh_index);
+    }
+  }
+
+  parallel_for((uint32)blocks.size(), [&](uint32 b) {
+    auto& block = blocks[b];
+    auto& defaults = block.mesh_asset->defaults;
+    auto& group = objects(block.mesh_asset->mesh_index);
+
+    for (uint32 i = 0; i < block.total_objects; i++) {
+      auto& object = group[block.start_index + i];
+      WorldObjectRecord record;
+
+      std::memcpy(&record, block.records + i * sizeof(WorldObjectRecord), sizeof(WorldObjectRecord));
+
+      object.position = tVec3f(record.position[0], record.position[1], record.position[2]);
+      object.scale = defaults.scale;
+      object.rotation = Quaternion(record.rotation[0], record.rotation[1], record.rotation[2], record.rotation[3]);
+      object.color.rgba = record.color;
+      object.material = defaults.material;
+
+      commit(object);
+    }
+  });
+
+  auto load_time = Tachyon_GetMicroseconds() - start_time;
+
+  console_log("Loaded binary world data in " + std::to_string(load_time) + "us");
+
+  return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+
+#include "engine/tachyon.h"
+#include "cosmodrone/game_types.h"
+
+namespace Cosmodrone {
+  namespace WorldData {
+    void SaveBinaryWorldData(Tachyon* tachyon, const std::string& path);
+    bool LoadBinaryWorldData(Tachyon* tachyon, const std::string& path);
+  }
+}
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "cosmodrone/mesh_library.h"
 #include "cosmodrone/object_behavior.h"
 #include "cosmodrone/procedural_generation.h"
+#include "cosmodrone/world_data.h"
 #include "cosmodrone/world_setup.h"
 
 using namespace Cosmodrone;
@@ -42,7 +44,31 @@ static const MeshAsset* GetMeshAssetByName(const std::string& mesh_name) {
   return nullptr;
 }
 
-static void LoadWorldData(Tachyon* tachyon, State& state, const std::string& file) {
+/**
+ * Binary world data is only used when it was saved
+ * after the last change to the text world data.
+ */
+static bool IsBinaryWorldDataCurrent(const std::string& text_file, const std::string& binary_file) {
+  std::error_code error;
+  auto text_write_time = std::filesystem::last_write_time(text_file, error);
+
+  if (error) {
+    return std::filesystem::exists(binary_file);
+  }
+
+  auto binary_write_time = std::filesystem::last_write_time(binary_file, error);
+
+  return !error && binary_write_time >= text_write_time;
+}
+
+static void LoadWorldData(Tachyon* tachyon, State& state, const std::string& file, const std::string& binary_file) {
+  if (
+    IsBinaryWorldDataCurrent(file, binary_file) &&
+    WorldData::LoadBinaryWorldData(tachyon, binary_file)
+  ) {
+    return;
+  }
+
   auto start_time = Tachyon_GetMicroseconds();
   auto data = Tachyon_GetFileContents(file.c_str());
   auto lines = SplitString(data, "\n");
@@ -169,9 +195,9 @@ static void InitLevel(Tachyon* tachyon, State& state) {
   }
 
   #if USE_PROCEDURAL_GENERATION == 1
-    LoadWorldData(tachyon, state, "./cosmodrone/data/world_2.txt");
+    LoadWorldData(tachyon, state, "./cosmodrone/data/world_2.txt", "./cosmodrone/data/world_2.bin");
   #else
-    LoadWorldData(tachyon, state, "./cosmodrone/data/world.txt");
+    LoadWorldData(tachyon, state, "./cosmodrone/data/world.txt", "./cosmodrone/data/world.bin");
   #endif
 }
 
@@ -282,6 +308,9 @@ void WorldSetup::InitWorld(Tachyon* tachyon, State& state) {
     CreateDebugMeshes(tachyon, state);
     CreateEditorGuidelines(tachyon, state);
   }
+
+  // Shrink object groups to what the world actually uses
+  Tachyon_CompactObjectGroups(tachyon);
 }
 
 void WorldSetup::RebuildWorld(Tachyon* tachyon, State& state) {
@@ -2,6 +2,9 @@
 
 uniform mat4 view_projection_matrix;
 uniform vec3 transform_origin;
+// Model matrix translations are relative to this point,
+// given relative to the camera origin
+uniform vec3 render_origin;
 
 layout (location = 0) in vec3 vertexPosition;
 layout (location = 1) in vec3 vertexNormal;
@@ -44,11 +47,11 @@ void main() {
   gl_Position = view_projection_matrix * vec4(transform_space_position, 1.0);
 
   fragSurface = SurfaceToUVec4(modelSurface);
-  modelPosition = translation;
-  basePosition = (modelMatrix * vec4(0, -1.0, 0, 1.0)).xyz;
-  topPosition = (modelMatrix * vec4(0, 1.0, 0, 1.0)).xyz;
+  modelPosition = translation + render_origin;
+  basePosition = (modelMatrix * vec4(0, -1.0, 0, 1.0)).xyz + render_origin;
+  topPosition = (modelMatrix * vec4(0, 1.0, 0, 1.0)).xyz + render_origin;
   upDirection = mat3(modelMatrix) * vec4(0, 1.0, 0, 1.0).xyz;
   vertPosition = vertexPosition;
-  fragPosition = model_space_position + translation;
+  fragPosition = model_space_position + translation + render_origin;
   fragNormal = normal_matrix * vertexNormal;
 }
\ No newline at end of file
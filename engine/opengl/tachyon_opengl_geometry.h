@@ -14,12 +14,17 @@ struct tOpenGLMeshPack {
   GLuint vao;
   GLuint buffers[3];
   GLuint ebo;
+  // Instance slots allocated in the surface/matrix buffers
+  uint32 total_instance_slots = 0;
 };
 
 struct tOpenGLVertexStream {
   GLuint vao;
   GLuint vbo;
   GLuint ebo;
+  // Vertices/face elements the buffers have room for
+  uint32 vertex_capacity = 0;
+  uint32 element_capacity = 0;
 };
 
 struct tOpenGLSkinnedMesh {
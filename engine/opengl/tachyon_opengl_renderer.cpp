@@ -564,6 +564,22 @@ static void UpdateRendererContext(Tachyon* tachyon) {
   ctx.camera_position = camera.position;
 }
 
+/**
+ * Object instance matrices are stored relative to the render origin,
+ * so the transform origin passed alongside them must be as well.
+ */
+static inline tVec3f GetInstanceTransformOrigin(const Tachyon::Scene& scene) {
+  return (scene.camera.origin - scene.render_origin + tVec3d(scene.transform_origin)).toVec3f();
+}
+
+/**
+ * Returns the render origin relative to the camera origin, which
+ * camera-space positions (e.g. camera.position) are relative to.
+ */
+static inline tVec3f GetCameraSpaceRenderOrigin(const Tachyon::Scene& scene) {
+  return (scene.render_origin - scene.camera.origin).toVec3f();
+}
+
 static inline void SetupDrawElementsIndirectCommand(DrawElementsIndirectCommand& command, const tMeshGeometry& geometry) {
   command.count = geometry.face_element_end - geometry.face_element_start;
   command.firstIndex = geometry.face_element_start;
@@ -674,6 +690,32 @@ static void AddLowestLodDrawElementsIndirectCommands(std::vector<DrawElementsInd
   AddDrawElementsIndirectCommands(commands, record, triangle_count, vertex_count);
 }
 
+/**
+ * Reallocates the instance surface/matrix buffers whenever object
+ * groups have grown or been compacted, and marks every group to be
+ * re-buffered into its new slots.
+ */
+static void ResizeInstanceBuffers(Tachyon* tachyon) {
+  auto& gl_mesh_pack = get_renderer().mesh_pack;
+  auto total_instance_slots = tachyon->mesh_pack.total_instance_slots;
+
+  if (gl_mesh_pack.total_instance_slots == total_instance_slots) {
+    return;
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, gl_mesh_pack.buffers[SURFACE_BUFFER]);
+  glBufferData(GL_ARRAY_BUFFER, total_instance_slots * sizeof(uint32), nullptr, GL_DYNAMIC_DRAW);
+
+  glBindBuffer(GL_ARRAY_BUFFER, gl_mesh_pack.buffers[MATRIX_BUFFER]);
+  glBufferData(GL_ARRAY_BUFFER, total_instance_slots * sizeof(tMat4f), nullptr, GL_DYNAMIC_DRAW);
+
+  for (auto& record : tachyon->mesh_pack.mesh_records) {
+    record.group.buffered = false;
+  }
+
+  gl_mesh_pack.total_instance_slots = total_instance_slots;
+}
+
 static void RenderMeshesByType(Tachyon* tachyon, tMeshType type, bool using_disocclusion = false) {
   auto& renderer = get_renderer();
   auto& gl_mesh_pack = renderer.mesh_pack;
@@ -764,7 +806,7 @@ static void RenderStaticMeshes(Tachyon* tachyon) {
   glUseProgram(shader.program);
   SetShaderBool(locations.has_texture, false);
   SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-  SetShaderVec3f(locations.transform_origin, tachyon->scene.transform_origin);
+  SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(tachyon->scene));
   SetShaderFloat(locations.scene_time, tachyon->scene.scene_time);
   SetShaderBool(locations.use_close_camera_disocclusion, false);
   SetShaderVec3f(locations.disocclusion_target_position, disocclusion_target_position);
@@ -858,21 +900,55 @@ static void RenderVertexStreams(Tachyon* tachyon, uint32& triangle_count, uint32
 
     glBindVertexArray(gl_stream.vao);
 
-    if (!base_stream.buffered) {
-      auto& vertices = base_stream.vertices;
-      auto& face_elements = base_stream.face_elements;
+    auto& vertices = base_stream.vertices;
+    auto& face_elements = base_stream.face_elements;
+
+    bool has_patches = (
+      base_stream.patched_vertices_end > base_stream.patched_vertices_start ||
+      base_stream.patched_elements_end > base_stream.patched_elements_start
+    );
+
+    bool has_outgrown_buffers = (
+      vertices.size() > gl_stream.vertex_capacity ||
+      face_elements.size() > gl_stream.element_capacity
+    );
+
+    if (!base_stream.buffered || (has_patches && has_outgrown_buffers)) {
+      // Size the buffers to the stream capacity,
+      // leaving room for the stream to be patched
+      gl_stream.vertex_capacity = (uint32)vertices.capacity();
+      gl_stream.element_capacity = (uint32)face_elements.capacity();
 
       // Buffer vertex data
       glBindBuffer(GL_ARRAY_BUFFER, gl_stream.vbo);
-      glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(tVertex), vertices.data(), GL_STATIC_DRAW);
+      glBufferData(GL_ARRAY_BUFFER, gl_stream.vertex_capacity * sizeof(tVertex), nullptr, GL_DYNAMIC_DRAW);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(tVertex), vertices.data());
 
       // Buffer vertex element data
       glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gl_stream.ebo);
-      glBufferData(GL_ELEMENT_ARRAY_BUFFER, face_elements.size() * sizeof(uint32), face_elements.data(), GL_STATIC_DRAW);
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER, gl_stream.element_capacity * sizeof(uint32), nullptr, GL_DYNAMIC_DRAW);
+      glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, face_elements.size() * sizeof(uint32), face_elements.data());
+    } else if (has_patches) {
+      uint32 vertices_start = base_stream.patched_vertices_start;
+      uint32 vertices_end = std::min(base_stream.patched_vertices_end, (uint32)vertices.size());
+      uint32 elements_start = base_stream.patched_elements_start;
+      uint32 elements_end = std::min(base_stream.patched_elements_end, (uint32)face_elements.size());
+
+      if (vertices_end > vertices_start) {
+        glBindBuffer(GL_ARRAY_BUFFER, gl_stream.vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, vertices_start * sizeof(tVertex), (vertices_end - vertices_start) * sizeof(tVertex), vertices.data() + vertices_start);
+      }
 
-      base_stream.buffered = true;
+      if (elements_end > elements_start) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gl_stream.ebo);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, elements_start * sizeof(uint32), (elements_end - elements_start) * sizeof(uint32), face_elements.data() + elements_start);
+      }
     }
 
+    base_stream.buffered = true;
+    base_stream.patched_vertices_start = base_stream.patched_vertices_end = 0;
+    base_stream.patched_elements_start = base_stream.patched_elements_end = 0;
+
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gl_stream.ebo);
 
     glDrawElements(GL_TRIANGLES, base_stream.face_elements.size(), GL_UNSIGNED_INT, 0);
@@ -997,7 +1073,7 @@ static void RenderPrimaryShadowMapCascades(Tachyon* tachyon) {
       glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
       SetShaderMat4f(locations.light_matrix, light_matrix);
-      SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+      SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
 
       // @allocation
       std::vector<DrawElementsIndirectCommand> commands;
@@ -1180,7 +1256,7 @@ static void RenderTransparentMeshesBeforePostEffects(Tachyon* tachyon) {
 
     glUseProgram(shader.program);
     SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-    SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+    SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
 
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
     glLineWidth(1.5f);
@@ -1197,7 +1273,8 @@ static void RenderTransparentMeshesBeforePostEffects(Tachyon* tachyon) {
 
     glUseProgram(shader.program);
     SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-    SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+    SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
+    SetShaderVec3f(locations.render_origin, GetCameraSpaceRenderOrigin(scene));
     SetShaderVec3f(locations.camera_position, ctx.camera_position);
     SetShaderVec3f(locations.primary_light_direction, scene.primary_light_direction);
     SetShaderFloat(locations.scene_time, scene.scene_time);
@@ -1218,7 +1295,8 @@ static void RenderTransparentMeshesBeforePostEffects(Tachyon* tachyon) {
 
     glUseProgram(shader.program);
     SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-    SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+    SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
+    SetShaderVec3f(locations.render_origin, GetCameraSpaceRenderOrigin(scene));
     SetShaderVec3f(locations.camera_position, ctx.camera_position);
     SetShaderVec3f(locations.primary_light_direction, scene.primary_light_direction);
     SetShaderInt(locations.previous_color_and_depth, ACCUMULATION_COLOR_AND_DEPTH);
@@ -1259,7 +1337,8 @@ static void RenderTransparentMeshesBeforePostEffects(Tachyon* tachyon) {
 
     glUseProgram(shader.program);
     SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-    SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+    SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
+    SetShaderVec3f(locations.render_origin, GetCameraSpaceRenderOrigin(scene));
     SetShaderVec3f(locations.camera_position, ctx.camera_position);
     SetShaderFloat(locations.scene_time, scene.scene_time);
 
@@ -1273,7 +1352,8 @@ static void RenderTransparentMeshesBeforePostEffects(Tachyon* tachyon) {
 
     glUseProgram(shader.program);
     SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-    SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+    SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
+    SetShaderVec3f(locations.render_origin, GetCameraSpaceRenderOrigin(scene));
     SetShaderFloat(locations.scene_time, scene.scene_time);
 
     RenderMeshesByType(tachyon, ION_THRUSTER_MESH);
@@ -1437,7 +1517,8 @@ static void RenderSunbeams(Tachyon* tachyon) {
 
   glUseProgram(shader.program);
   SetShaderMat4f(locations.view_projection_matrix, ctx.view_projection_matrix);
-  SetShaderVec3f(locations.transform_origin, scene.transform_origin);
+  SetShaderVec3f(locations.transform_origin, GetInstanceTransformOrigin(scene));
+  SetShaderVec3f(locations.render_origin, GetCameraSpaceRenderOrigin(scene));
   SetShaderVec3f(locations.camera_position, ctx.camera_position);
   SetShaderFloat(locations.scene_time, scene.scene_time);
 
@@ -1581,17 +1662,7 @@ void Tachyon_OpenGL_InitRenderer(Tachyon* tachyon) {
     }
   }
 
-  {
-    // Buffer surface data
-    auto& surfaces = tachyon->surfaces;
-    glBindBuffer(GL_ARRAY_BUFFER, renderer->mesh_pack.buffers[SURFACE_BUFFER]);
-    glBufferData(GL_ARRAY_BUFFER, surfaces.size() * sizeof(uint32), surfaces.data(), GL_DYNAMIC_DRAW);
-
-    // Buffer matrices
-    auto& matrices = tachyon->matrices;
-    glBindBuffer(GL_ARRAY_BUFFER, renderer->mesh_pack.buffers[MATRIX_BUFFER]);
-    glBufferData(GL_ARRAY_BUFFER, matrices.size() * sizeof(tMat4f), matrices.data(), GL_DYNAMIC_DRAW);
-  }
+  // Surface/matrix buffers are allocated by ResizeInstanceBuffers()
 }
 
 void Tachyon_OpenGL_HandleWindowResize(Tachyon* tachyon) {
@@ -1636,6 +1707,7 @@ void Tachyon_OpenGL_RenderScene(Tachyon* tachyon) {
   }
 
   UpdateRendererContext(tachyon);
+  ResizeInstanceBuffers(tachyon);
   RenderStaticMeshes(tachyon);
   RenderVertexStreams(tachyon, renderer.total_triangles, renderer.total_vertices);
   RenderSkinnedMeshes(tachyon);
@@ -168,26 +168,31 @@ static void StoreShaderUniforms(tOpenGLShaders& shaders) {
 
   store_shader_uniform(volumetric_mesh, view_projection_matrix);
   store_shader_uniform(volumetric_mesh, transform_origin);
+  store_shader_uniform(volumetric_mesh, render_origin);
   store_shader_uniform(volumetric_mesh, camera_position);
   store_shader_uniform(volumetric_mesh, primary_light_direction);
   store_shader_uniform(volumetric_mesh, scene_time);
 
   store_shader_uniform(fire_mesh, view_projection_matrix);
   store_shader_uniform(fire_mesh, transform_origin);
+  store_shader_uniform(fire_mesh, render_origin);
   store_shader_uniform(fire_mesh, camera_position);
   store_shader_uniform(fire_mesh, scene_time);
 
   store_shader_uniform(ion_thruster_mesh, view_projection_matrix);
   store_shader_uniform(ion_thruster_mesh, transform_origin);
+  store_shader_uniform(ion_thruster_mesh, render_origin);
   store_shader_uniform(ion_thruster_mesh, scene_time);
 
   store_shader_uniform(sunbeam_mesh, view_projection_matrix);
   store_shader_uniform(sunbeam_mesh, transform_origin);
+  store_shader_uniform(sunbeam_mesh, render_origin);
   store_shader_uniform(sunbeam_mesh, camera_position);
   store_shader_uniform(sunbeam_mesh, scene_time);
 
   store_shader_uniform(water_mesh, view_projection_matrix);
   store_shader_uniform(water_mesh, transform_origin);
+  store_shader_uniform(water_mesh, render_origin);
   store_shader_uniform(water_mesh, camera_position);
   store_shader_uniform(water_mesh, primary_light_direction);
   store_shader_uniform(water_mesh, previous_color_and_depth);
@@ -121,6 +121,7 @@ struct tUniformLocations {
   uniform_locations(
     view_projection_matrix,
     transform_origin,
+    render_origin,
     camera_position,
     primary_light_direction,
     scene_time
@@ -129,6 +130,7 @@ struct tUniformLocations {
   uniform_locations(
     view_projection_matrix,
     transform_origin,
+    render_origin,
     camera_position,
     scene_time
   ) fire_mesh;
@@ -136,12 +138,14 @@ struct tUniformLocations {
   uniform_locations(
     view_projection_matrix,
     transform_origin,
+    render_origin,
     scene_time
   ) ion_thruster_mesh;
 
   uniform_locations(
     view_projection_matrix,
     transform_origin,
+    render_origin,
     camera_position,
     scene_time
   ) sunbeam_mesh;
@@ -149,6 +153,7 @@ struct tUniformLocations {
   uniform_locations(
     view_projection_matrix,
     transform_origin,
+    render_origin,
     camera_position,
     primary_light_direction,
     projection_matrix,
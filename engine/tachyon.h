@@ -1,15 +1,20 @@
 #pragma once
 
+#include "engine/tachyon_bvh.h"
 #include "engine/tachyon_console.h"
 #include "engine/tachyon_constants.h"
 #include "engine/tachyon_easing.h"
 #include "engine/tachyon_file_helpers.h"
 #include "engine/tachyon_input.h"
+#include "engine/tachyon_jobs.h"
 #include "engine/tachyon_life_cycle.h"
 #include "engine/tachyon_loaders.h"
 #include "engine/tachyon_mesh_manager.h"
+#include "engine/tachyon_particles.h"
 #include "engine/tachyon_random.h"
 #include "engine/tachyon_sound.h"
+#include "engine/tachyon_spatial_grid.h"
+#include "engine/tachyon_systems.h"
 #include "engine/tachyon_timer.h"
 #include "engine/tachyon_types.h"
 #include "engine/tachyon_ui.h"
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cmath>
+#include <float.h>
+
+#include "engine/tachyon_bvh.h"
+
+static inline tBounds Union(const tBounds& a, const tBounds& b) {
+  tBounds bounds;
+  bounds.min = tVec3f(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z));
+  bounds.max = tVec3f(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z));
+
+  return bounds;
+}
+
+static inline bool Overlaps(const tBounds& a, const tBounds& b) {
+  return (
+    a.min.x <= b.max.x && a.max.x >= b.min.x &&
+    a.min.y <= b.max.y && a.max.y >= b.min.y &&
+    a.min.z <= b.max.z && a.max.z >= b.min.z
+  );
+}
+
+static inline bool ContainsPoint(const tBounds& bounds, const tVec3f& point) {
+  return (
+    point.x >= bounds.min.x && point.x <= bounds.max.x &&
+    point.y >= bounds.min.y && point.y <= bounds.max.y &&
+    point.z >= bounds.min.z && point.z <= bounds.max.z
+  );
+}
+
+/**
+ * Slab test, using the reciprocal of the ray direction. Axes the
+ * ray runs parallel to have an infinite reciprocal, and are handled
+ * separately, since the general case can produce 0 * infinity.
+ */
+static inline bool IntersectsRay(const tBounds& bounds, const tVec3f& origin, const tVec3f& inverse_direction, const float max_distance) {
+  float t_min = 0.f;
+  float t_max = max_distance;
+
+  const float origins[] = { origin.x, origin.y, origin.z };
+  const float inverses[] = { inverse_direction.x, inverse_direction.y, inverse_direction.z };
+  const float mins[] = { bounds.min.x, bounds.min.y, bounds.min.z };
+  const float maxes[] = { bounds.max.x, bounds.max.y, bounds.max.z };
+
+  for (int i = 0; i < 3; i++) {
+    if (std::isinf(inverses[i])) {
+      // Parallel to this axis' slab, so the ray is either always
+      // or never within it
+      if (origins[i] < mins[i] || origins[i] > maxes[i]) {
+        return false;
+      }
+
+      continue;
+    }
+
+    float t1 = (mins[i] - origins[i]) * inverses[i];
+    float t2 = (maxes[i] - origins[i]) * inverses[i];
+
+    t_min = std::max(t_min, std::min(t1, t2));
+    t_max = std::min(t_max, std::max(t1, t2));
+  }
+
+  return t_min <= t_max;
+}
+
+static inline float GetAxis(const tVec3f& vector, const int axis) {
+  return axis == 0 ? vector.x : axis == 1 ? vector.y : vector.z;
+}
+
+/**
+ * Splits items [start, end) at the median of their centers along
+ * the longest axis of their combined centers, recursively.
+ */
+static int32 BuildNode(tBVH& bvh, const std::vector<tBounds>& item_bounds, std::vector<uint32>& items, const uint32 start, const uint32 end, const int32 parent) {
+  int32 node_index = (int32)bvh.nodes.size();
+
+  bvh.nodes.push_back(tBVHNode());
+  bvh.nodes[node_index].parent = parent;
+
+  if (end - start == 1) {
+    auto& node = bvh.nodes[node_index];
+    uint32 item = items[start];
+
+    node.bounds = item_bounds[item];
+    node.item = (int32)item;
+
+    bvh.item_leaves[item] = node_index;
+
+    return node_index;
+  }
+
+  tVec3f center_min = tVec3f(FLT_MAX);
+  tVec3f center_max = tVec3f(-FLT_MAX);
+
+  for (uint32 i = start; i < end; i++) {
+    auto& bounds = item_bounds[items[i]];
+    tVec3f center = (bounds.min + bounds.max) * 0.5f;
+
+    center_min = tVec3f(std::min(center_min.x, center.x), std::min(center_min.y, center.y), std::min(center_min.z, center.z));
+    center_max = tVec3f(std::max(center_max.x, center.x), std::max(center_max.y, center.y), std::max(center_max.z, center.z));
+  }
+
+  tVec3f extent = center_max - center_min;
+  int axis = extent.x > extent.y && extent.x > extent.z ? 0 : extent.y > extent.z ? 1 : 2;
+  uint32 middle = start + (end - start) / 2;
+
+  std::nth_element(items.begin() + start, items.begin() + middle, items.begin() + end, [&](uint32 a, uint32 b) {
+    auto& bounds_a = item_bounds[a];
+    auto& bounds_b = item_bounds[b];
+
+    return GetAxis(bounds_a.min + bounds_a.max, axis) < GetAxis(bounds_b.min + bounds_b.max, axis);
+  });
+
+  int32 left = BuildNode(bvh, item_bounds, items, start, middle, node_index);
+  int32 right = BuildNode(bvh, item_bounds, items, middle, end, node_index);
+
+  auto& node = bvh.nodes[node_index];
+
+  node.left = left;
+  node.right = right;
+  node.bounds = Union(bvh.nodes[left].bounds, bvh.nodes[right].bounds);
+
+  return node_index;
+}
+
+template<typename T>
+static void QueryNodes(const tBVH& bvh, std::vector<uint32>& results, T&& overlaps) {
+  results.clear();
+
+  if (bvh.root == -1) {
+    return;
+  }
+
+  int32 stack[64];
+  int32 stack_size = 0;
+
+  stack[stack_size++] = bvh.root;
+
+  while (stack_size > 0) {
+    auto& node = bvh.nodes[stack[--stack_size]];
+
+    if (!overlaps(node.bounds)) {
+      continue;
+    }
+
+    if (node.item != -1) {
+      results.push_back((uint32)node.item);
+    } else {
+      stack[stack_size++] = node.left;
+      stack[stack_size++] = node.right;
+    }
+  }
+}
+
+tBounds Tachyon_GetSphereBounds(const tVec3f& center, const float radius) {
+  return {
+    center - tVec3f(radius),
+    center + tVec3f(radius)
+  };
+}
+
+tBounds Tachyon_GetSweptSphereBounds(const tVec3f& start, const tVec3f& end, const float radius) {
+  return Union(
+    Tachyon_GetSphereBounds(start, radius),
+    Tachyon_GetSphereBounds(end, radius)
+  );
+}
+
+bool Tachyon_SegmentIntersectsBounds(const tBounds& bounds, const tVec3f& start, const tVec3f& end) {
+  tVec3f direction = end - start;
+  tVec3f inverse_direction = tVec3f(1.f / direction.x, 1.f / direction.y, 1.f / direction.z);
+
+  // Measure along the unnormalized direction, so the segment spans [0, 1]
+  return IntersectsRay(bounds, start, inverse_direction, 1.f);
+}
+
+void Tachyon_BuildBVH(tBVH& bvh, const std::vector<tBounds>& item_bounds) {
+  uint32 total_items = (uint32)item_bounds.size();
+
+  bvh.nodes.clear();
+  bvh.item_leaves.assign(total_items, -1);
+  bvh.root = -1;
+
+  if (total_items == 0) {
+    return;
+  }
+
+  // @allocation
+  std::vector<uint32> items(total_items);
+
+  for (uint32 i = 0; i < total_items; i++) {
+    items[i] = i;
+  }
+
+  bvh.nodes.reserve(2 * total_items - 1);
+  bvh.root = BuildNode(bvh, item_bounds, items, 0, total_items, -1);
+}
+
+/**
+ * Refits an item's leaf and every node above it to the item's new bounds.
+ */
+void Tachyon_UpdateBVHItem(tBVH& bvh, const uint32 item, const tBounds& bounds) {
+  int32 node_index = bvh.item_leaves[item];
+
+  bvh.nodes[node_index].bounds = bounds;
+  node_index = bvh.nodes[node_index].parent;
+
+  while (node_index != -1) {
+    auto& node = bvh.nodes[node_index];
+
+    node.bounds = Union(bvh.nodes[node.left].bounds, bvh.nodes[node.right].bounds);
+    node_index = node.parent;
+  }
+}
+
+void Tachyon_QueryBVHPoint(const tBVH& bvh, const tVec3f& point, std::vector<uint32>& results) {
+  QueryNodes(bvh, results, [&](const tBounds& bounds) {
+    return ContainsPoint(bounds, point);
+  });
+}
+
+void Tachyon_QueryBVHBounds(const tBVH& bvh, const tBounds& query_bounds, std::vector<uint32>& results) {
+  QueryNodes(bvh, results, [&](const tBounds& bounds) {
+    return Overlaps(bounds, query_bounds);
+  });
+}
+
+void Tachyon_QueryBVHRay(const tBVH& bvh, const tVec3f& origin, const tVec3f& direction, const float max_distance, std::vector<uint32>& results) {
+  tVec3f inverse_direction = tVec3f(1.f / direction.x, 1.f / direction.y, 1.f / direction.z);
+
+  QueryNodes(bvh, results, [&](const tBounds& bounds) {
+    return IntersectsRay(bounds, origin, inverse_direction, max_distance);
+  });
+}
\ No newline at end of file
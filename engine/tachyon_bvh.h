@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "engine/tachyon_aliases.h"
+#include "engine/tachyon_linear_algebra.h"
+
+struct tBounds {
+  tVec3f min;
+  tVec3f max;
+};
+
+struct tBVHNode {
+  tBounds bounds;
+  int32 left = -1;
+  int32 right = -1;
+  int32 parent = -1;
+  // The item stored in a leaf node, or -1 for interior nodes
+  int32 item = -1;
+};
+
+/**
+ * ----------------------------
+ * A bounding volume hierarchy over a list of items, each leaf
+ * holding one item. Items are referred to by their index in the
+ * list the hierarchy was built from. Moved items can be refit in
+ * place; adding or removing items requires a rebuild.
+ * ----------------------------
+ */
+struct tBVH {
+  std::vector<tBVHNode> nodes;
+  // The leaf node for each item
+  std::vector<int32> item_leaves;
+  int32 root = -1;
+};
+
+tBounds Tachyon_GetSphereBounds(const tVec3f& center, const float radius);
+tBounds Tachyon_GetSweptSphereBounds(const tVec3f& start, const tVec3f& end, const float radius);
+bool Tachyon_SegmentIntersectsBounds(const tBounds& bounds, const tVec3f& start, const tVec3f& end);
+void Tachyon_BuildBVH(tBVH& bvh, const std::vector<tBounds>& item_bounds);
+void Tachyon_UpdateBVHItem(tBVH& bvh, const uint32 item, const tBounds& bounds);
+void Tachyon_QueryBVHPoint(const tBVH& bvh, const tVec3f& point, std::vector<uint32>& results);
+void Tachyon_QueryBVHBounds(const tBVH& bvh, const tBounds& bounds, std::vector<uint32>& results);
+void Tachyon_QueryBVHRay(const tBVH& bvh, const tVec3f& origin, const tVec3f& direction, const float max_distance, std::vector<uint32>& results);
\ No newline at end of file
@@ -25,6 +25,9 @@ struct tOrientation {
 };
 
 struct tCamera {
+  // Double-precision origin which position is relative to,
+  // for cameras far from the world origin
+  tVec3d origin;
   tVec3f position;
   tOrientation orientation;
   float fov = 45.f;
@@ -24,6 +24,29 @@ std::string Tachyon_GetFileContents(const char* path) {
   return source;
 }
 
+/**
+ * Reads an entire file in one go, without any newline handling.
+ */
+std::string Tachyon_GetBinaryFileContents(const char* path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+  if (file.fail()) {
+    printf("\033[31m" "[Tachyon_GetBinaryFileContents] Failed to load file: %s\n" "\033[0m", path);
+
+    return "";
+  }
+
+  std::string contents;
+  auto size = file.tellg();
+
+  contents.resize(size_t(size));
+  file.seekg(0);
+  file.read(contents.data(), size);
+  file.close();
+
+  return contents;
+}
+
 void Tachyon_WriteFileContents(const std::string& path, const std::string& contents) {
   auto last_slash_index = path.find_last_of("/");
   auto directories = path.substr(0, last_slash_index);
@@ -34,4 +57,16 @@ void Tachyon_WriteFileContents(const std::string& path, const std::string& conte
   file.open(path, std::fstream::out);
   file << contents;
   file.close();
+}
+
+void Tachyon_WriteBinaryFileContents(const std::string& path, const std::string& contents) {
+  auto last_slash_index = path.find_last_of("/");
+  auto directories = path.substr(0, last_slash_index);
+  std::ofstream file;
+
+  std::filesystem::create_directories(directories);
+
+  file.open(path, std::fstream::out | std::fstream::binary);
+  file.write(contents.data(), contents.size());
+  file.close();
 }
\ No newline at end of file
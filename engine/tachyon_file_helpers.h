@@ -3,4 +3,6 @@
 #include <string>
 
 std::string Tachyon_GetFileContents(const char* path);
-void Tachyon_WriteFileContents(const std::string& path, const std::string& contents);
\ No newline at end of file
+std::string Tachyon_GetBinaryFileContents(const char* path);
+void Tachyon_WriteFileContents(const std::string& path, const std::string& contents);
+void Tachyon_WriteBinaryFileContents(const std::string& path, const std::string& contents);
\ No newline at end of file
@@ -0,0 +1,269 @@
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "engine/tachyon_jobs.h"
+
+/**
+ * A contiguous range of job indexes owned by one participant,
+ * packed as [begin, end) into a single atomic so it can be
+ * popped from the front by its owner and split from the back
+ * by other participants without locking.
+ */
+struct alignas(64) tJobRange {
+  std::atomic<uint64> range = 0;
+};
+
+static std::vector<std::thread> workers;
+static std::unique_ptr<tJobRange[]> job_ranges;
+static std::mutex jobs_mutex;
+// Held for the duration of each batch, so threads
+// calling Tachyon_ParallelFor take turns
+static std::mutex batch_mutex;
+static std::condition_variable jobs_condition;
+static std::condition_variable jobs_done_condition;
+
+static const std::function<void(uint32)>* current_job = nullptr;
+static uint32 current_job_total = 0;
+static uint64 current_batch_id = 0;
+static std::atomic<uint32> completed_jobs = 0;
+static uint32 active_workers = 0;
+static bool is_exiting = false;
+
+static thread_local bool is_running_jobs = false;
+
+static inline uint64 PackRange(const uint32 begin, const uint32 end) {
+  return (uint64(end) << 32) | uint64(begin);
+}
+
+static inline uint32 GetTotalParticipants() {
+  return (uint32)workers.size() + 1;
+}
+
+static bool PopJob(tJobRange& job_range, uint32& index) {
+  uint64 range = job_range.range.load();
+
+  while (true) {
+    uint32 begin = uint32(range);
+    uint32 end = uint32(range >> 32);
+
+    if (begin >= end) {
+      return false;
+    }
+
+    if (job_range.range.compare_exchange_weak(range, PackRange(begin + 1, end))) {
+      index = begin;
+
+      return true;
+    }
+  }
+}
+
+/**
+ * Takes the back half of another participant's range, leaving
+ * the front half (closest to what it is currently running) to it.
+ */
+static bool StealJobs(tJobRange& victim, uint32& stolen_begin, uint32& stolen_end) {
+  uint64 range = victim.range.load();
+
+  while (true) {
+    uint32 begin = uint32(range);
+    uint32 end = uint32(range >> 32);
+
+    if (begin >= end) {
+      return false;
+    }
+
+    uint32 middle = begin + (end - begin) / 2;
+
+    if (victim.range.compare_exchange_weak(range, PackRange(begin, middle))) {
+      stolen_begin = middle;
+      stolen_end = end;
+
+      return true;
+    }
+  }
+}
+
+static bool ClaimJob(const uint32 slot, uint32& index) {
+  auto& own_range = job_ranges[slot];
+
+  if (PopJob(own_range, index)) {
+    return true;
+  }
+
+  uint32 total_participants = GetTotalParticipants();
+
+  for (uint32 i = 1; i < total_participants; i++) {
+    uint32 stolen_begin;
+    uint32 stolen_end;
+
+    if (StealJobs(job_ranges[(slot + i) % total_participants], stolen_begin, stolen_end)) {
+      // Our own range is empty, so nobody else can be modifying it
+      own_range.range.store(PackRange(stolen_begin + 1, stolen_end));
+      index = stolen_begin;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Runs jobs from this participant's own range, then steals
+ * from the others until every range is empty. Shared by the
+ * workers and the calling thread.
+ */
+static void RunAvailableJobs(const std::function<void(uint32)>& job, const uint32 total, const uint32 slot) {
+  uint32 index;
+
+  is_running_jobs = true;
+
+  while (ClaimJob(slot, index)) {
+    job(index);
+
+    if (completed_jobs.fetch_add(1) + 1 == total) {
+      std::lock_guard<std::mutex> lock(jobs_mutex);
+
+      jobs_done_condition.notify_all();
+    }
+  }
+
+  is_running_jobs = false;
+}
+
+static void WorkerLoop(const uint32 slot) {
+  uint64 last_batch_id = 0;
+
+  while (true) {
+    const std::function<void(uint32)>* job;
+    uint32 total;
+
+    {
+      std::unique_lock<std::mutex> lock(jobs_mutex);
+
+      jobs_condition.wait(lock, [&]() {
+        return is_exiting || current_batch_id != last_batch_id;
+      });
+
+      if (is_exiting) {
+        return;
+      }
+
+      last_batch_id = current_batch_id;
+      job = current_job;
+      total = current_job_total;
+      active_workers++;
+    }
+
+    RunAvailableJobs(*job, total, slot);
+
+    {
+      std::lock_guard<std::mutex> lock(jobs_mutex);
+
+      active_workers--;
+    }
+
+    jobs_done_condition.notify_all();
+  }
+}
+
+void Tachyon_InitJobSystem() {
+  uint32 total_threads = std::thread::hardware_concurrency();
+  uint32 total_workers = total_threads > 1 ? total_threads - 1 : 0;
+
+  job_ranges = std::make_unique<tJobRange[]>(total_workers + 1);
+
+  // Leave one hardware thread for the main thread, which
+  // also participates in running jobs as slot 0
+  for (uint32 i = 1; i <= total_workers; i++) {
+    workers.push_back(std::thread(WorkerLoop, i));
+  }
+}
+
+uint32 Tachyon_GetTotalJobWorkers() {
+  return GetTotalParticipants();
+}
+
+/**
+ * Runs job(0) ... job(total - 1) across the worker threads and
+ * the calling thread, returning once every job has completed.
+ * Each participant starts with an even, contiguous share of the
+ * indexes and steals from the others once its share runs out.
+ * Jobs must only write to data owned by their own index.
+ *
+ * Calls made from inside a job run serially on that thread.
+ * Calls made from other threads wait for the current batch.
+ */
+void Tachyon_ParallelFor(const uint32 total, const std::function<void(uint32)>& job) {
+  if (total == 0) {
+    return;
+  }
+
+  if (total == 1 || workers.size() == 0 || is_running_jobs) {
+    for (uint32 i = 0; i < total; i++) {
+      job(i);
+    }
+
+    return;
+  }
+
+  std::lock_guard<std::mutex> batch_lock(batch_mutex);
+
+  {
+    std::unique_lock<std::mutex> lock(jobs_mutex);
+
+    // Workers which picked up the previous batch late must
+    // leave it before its ranges can be reset
+    jobs_done_condition.wait(lock, []() {
+      return active_workers == 0;
+    });
+
+    uint32 total_participants = GetTotalParticipants();
+
+    for (uint32 i = 0; i < total_participants; i++) {
+      uint32 begin = uint32(uint64(total) * i / total_participants);
+      uint32 end = uint32(uint64(total) * (i + 1) / total_participants);
+
+      job_ranges[i].range.store(PackRange(begin, end));
+    }
+
+    current_job = &job;
+    current_job_total = total;
+    completed_jobs = 0;
+    current_batch_id++;
+  }
+
+  jobs_condition.notify_all();
+
+  RunAvailableJobs(job, total, 0);
+
+  {
+    std::unique_lock<std::mutex> lock(jobs_mutex);
+
+    jobs_done_condition.wait(lock, [&]() {
+      return completed_jobs.load() == total && active_workers == 0;
+    });
+  }
+}
+
+void Tachyon_ExitJobSystem() {
+  {
+    std::lock_guard<std::mutex> lock(jobs_mutex);
+
+    is_exiting = true;
+  }
+
+  jobs_condition.notify_all();
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  workers.clear();
+  job_ranges.reset();
+}
\ No newline at end of file
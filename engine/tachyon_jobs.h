@@ -0,0 +1,12 @@
+#pragma once
+
+#include <functional>
+
+#include "engine/tachyon_aliases.h"
+
+#define parallel_for(__total, __job) Tachyon_ParallelFor(__total, __job)
+
+void Tachyon_InitJobSystem();
+uint32 Tachyon_GetTotalJobWorkers();
+void Tachyon_ParallelFor(const uint32 total, const std::function<void(uint32)>& job);
+void Tachyon_ExitJobSystem();
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "engine/tachyon_aliases.h"
 #include "engine/tachyon_console.h"
 #include "engine/tachyon_input.h"
+#include "engine/tachyon_jobs.h"
 #include "engine/tachyon_life_cycle.h"
 #include "engine/tachyon_sound.h"
 #include "engine/tachyon_timer.h"
@@ -103,6 +104,7 @@ Tachyon* Tachyon_Init() {
   auto* tachyon = new Tachyon;
 
   Tachyon_InitSoundEngine();
+  Tachyon_InitJobSystem();
 
   SDL_GameControllerAddMappingsFromFile("./controllers.txt");
 
@@ -244,6 +246,7 @@ void Tachyon_Exit(Tachyon* tachyon) {
   TTF_CloseFont(tachyon->developer_overlay_font);
 
   Tachyon_ExitSoundEngine();
+  Tachyon_ExitJobSystem();
 
   if (tachyon->renderer != nullptr) {
     DestroyRenderer(tachyon);
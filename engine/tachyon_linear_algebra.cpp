@@ -167,6 +167,46 @@ std::string tVec3f::toString() const {
   return std::format("x: {:.3f}, y: {:.3f}, z: {:.3f}", x, y, z);
 }
 
+tVec3d tVec3d::operator+(const tVec3d& v) const {
+  return {
+    x + v.x,
+    y + v.y,
+    z + v.z
+  };
+}
+
+tVec3d tVec3d::operator-(const tVec3d& v) const {
+  return {
+    x - v.x,
+    y - v.y,
+    z - v.z
+  };
+}
+
+bool tVec3d::operator==(const tVec3d& v) const {
+  return x == v.x && y == v.y && z == v.z;
+}
+
+void tVec3d::operator+=(const tVec3d& v) {
+  x += v.x;
+  y += v.y;
+  z += v.z;
+}
+
+void tVec3d::operator-=(const tVec3d& v) {
+  x -= v.x;
+  y -= v.y;
+  z -= v.z;
+}
+
+double tVec3d::magnitude() const {
+  return sqrt(x*x + y*y + z*z);
+}
+
+tVec3f tVec3d::toVec3f() const {
+  return tVec3f(float(x), float(y), float(z));
+}
+
 tVec4f tVec4f::operator*(const tVec4f& v) const {
   return {
     x * v.x,
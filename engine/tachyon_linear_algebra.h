@@ -45,6 +45,29 @@ struct tVec3f {
   std::string toString() const;
 };
 
+/**
+ * A double-precision vector, for world positions far enough
+ * from the origin that tVec3f would lose precision.
+ */
+struct tVec3d {
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+
+  tVec3d() {};
+  tVec3d(double x, double y, double z) : x(x), y(y), z(z) {};
+  tVec3d(const tVec3f& v) : x(v.x), y(v.y), z(v.z) {};
+
+  tVec3d operator+(const tVec3d& v) const;
+  tVec3d operator-(const tVec3d& v) const;
+  bool operator==(const tVec3d& v) const;
+  void operator+=(const tVec3d& v);
+  void operator-=(const tVec3d& v);
+
+  double magnitude() const;
+  tVec3f toVec3f() const;
+};
+
 struct tVec4f {
   float x = 0.f;
   float y = 0.f;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <math.h>
 
@@ -456,12 +457,9 @@ uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh, uint16 total) {
 
   record.lod_1 = geometry;
   record.mesh_index = (uint16)pack.mesh_records.size();
+  // Object group storage is allocated in Tachyon_InitializeObjects()
   record.group.total = total;
-
-  // Manually allocate the mesh group's id -> index lookup table.
-  // Its object/matrix/surface arrays are just pointers into the
-  // global mesh pack's, so we need not worry about those.
-  record.group.id_to_index = new uint16[total];
+  record.group.declared_total = total;
 
   pack.mesh_records.push_back(record);
 
@@ -485,12 +483,9 @@ uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh_lod_1, const tMesh& m
   AddLevelOfDetail(tachyon, record, mesh_lod_2, record.lod_2);
 
   record.mesh_index = (uint16)pack.mesh_records.size();
+  // Object group storage is allocated in Tachyon_InitializeObjects()
   record.group.total = total;
-
-  // Manually allocate the mesh group's id -> index lookup table.
-  // Its object/matrix/surface arrays are just pointers into the
-  // global mesh pack's, so we need not worry about those.
-  record.group.id_to_index = new uint16[total];
+  record.group.declared_total = total;
 
   pack.mesh_records.push_back(record);
 
@@ -506,12 +501,9 @@ uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh_lod_1, const tMesh& m
   AddLevelOfDetail(tachyon, record, mesh_lod_3, record.lod_3);
 
   record.mesh_index = (uint16)pack.mesh_records.size();
+  // Object group storage is allocated in Tachyon_InitializeObjects()
   record.group.total = total;
-
-  // Manually allocate the mesh group's id -> index lookup table.
-  // Its object/matrix/surface arrays are just pointers into the
-  // global mesh pack's, so we need not worry about those.
-  record.group.id_to_index = new uint16[total];
+  record.group.declared_total = total;
 
   pack.mesh_records.push_back(record);
 
@@ -526,61 +518,282 @@ int32 Tachyon_AddVertexStream(Tachyon* tachyon) {
   return (int32) (tachyon->vertex_streams.size() - 1);
 }
 
+/**
+ * Marks a range of vertices and face elements in a buffered stream
+ * as changed, so only those ranges are uploaded again. Streams which
+ * have grown past their buffers are uploaded in full instead.
+ */
+void Tachyon_PatchVertexStream(tVertexStream& stream, const uint32 vertex_start, const uint32 total_vertices, const uint32 element_start, const uint32 total_elements) {
+  auto extend = [](uint32& start, uint32& end, const uint32 range_start, const uint32 range_end) {
+    if (range_start == range_end) {
+      return;
+    }
+
+    if (start == end) {
+      start = range_start;
+      end = range_end;
+    } else {
+      start = std::min(start, range_start);
+      end = std::max(end, range_end);
+    }
+  };
+
+  extend(stream.patched_vertices_start, stream.patched_vertices_end, vertex_start, vertex_start + total_vertices);
+  extend(stream.patched_elements_start, stream.patched_elements_end, element_start, element_start + total_elements);
+}
+
 int32 Tachyon_AddSkinnedMesh(Tachyon* tachyon, const tSkinnedMesh& skinned_mesh) {
   tachyon->skinned_meshes.push_back(skinned_mesh);
 
   return (int32)(tachyon->skinned_meshes.size() - 1);
 }
 
-void Tachyon_InitializeObjects(Tachyon* tachyon) {
-  uint32 total_objects = 0;
+/**
+ * Points a mesh record's instances at a new range of slots
+ * in the instance buffers, keeping any level of detail splits.
+ */
+static void SetObjectGroupOffset(tMeshRecord& record, const uint32 object_offset) {
+  auto lod_2_start = record.lod_2.base_instance - record.lod_1.base_instance;
+  auto lod_3_start = record.lod_3.base_instance - record.lod_1.base_instance;
 
-  for (auto& record : tachyon->mesh_pack.mesh_records) {
-    total_objects += record.group.total;
+  record.group.object_offset = object_offset;
+
+  record.lod_1.base_instance = object_offset;
+  record.lod_2.base_instance = object_offset + lod_2_start;
+  record.lod_3.base_instance = object_offset + lod_3_start;
+
+  record.group.buffered = false;
+}
+
+/**
+ * Replaces an object group's instance data with arrays of a new size,
+ * freeing the old ones. Objects live in separate chunks.
+ */
+static void ReplaceObjectGroupStorage(tObjectGroup& group, uint32* surfaces, tMat4f* matrices, uint16* id_to_index, const uint16 total) {
+  delete[] group.surfaces;
+  delete[] group.matrices;
+  delete[] group.id_to_index;
+
+  group.surfaces = surfaces;
+  group.matrices = matrices;
+  group.id_to_index = id_to_index;
+  group.total = total;
+}
+
+/**
+ * Allocates or frees object chunks, so a group has exactly
+ * enough of them to hold a given total. Chunks which are kept
+ * stay where they are.
+ */
+static void ResizeObjectChunks(tObjectGroup& group, const uint32 total) {
+  size_t total_chunks = (total + OBJECT_CHUNK_SIZE - 1) / OBJECT_CHUNK_SIZE;
+
+  while (group.object_chunks.size() > total_chunks) {
+    delete[] group.object_chunks.back();
+
+    group.object_chunks.pop_back();
+  }
+
+  while (group.object_chunks.size() < total_chunks) {
+    group.object_chunks.push_back(new tObject[OBJECT_CHUNK_SIZE]);
   }
+}
 
-  tachyon->objects.resize(total_objects);
-  tachyon->surfaces.resize(total_objects);
-  tachyon->matrices.resize(total_objects);
+/**
+ * Returns a group's instance buffer slots to the pack, either
+ * by trimming the end of the used slots or for later reuse.
+ */
+static void ReleaseInstanceSlots(tMeshPack& pack, const uint32 offset, const uint32 total) {
+  if (total == 0) {
+    return;
+  }
 
-  uint16 mesh_index = 0;
-  uint32 object_offset = 0;
+  if (offset + total == pack.total_instance_slots) {
+    pack.total_instance_slots = offset;
+  } else {
+    pack.free_instance_slot_ranges.push_back({ offset, total });
+  }
+}
 
-  for (auto& record : tachyon->mesh_pack.mesh_records) {
-    // Set object group pointers into global arrays
-    record.group.objects = &tachyon->objects[object_offset];
-    record.group.surfaces = &tachyon->surfaces[object_offset];
-    record.group.matrices = &tachyon->matrices[object_offset];
-    record.group.object_offset = object_offset;
-
-    record.lod_1.base_instance = object_offset;
-    record.lod_2.base_instance = object_offset;
-    record.lod_3.base_instance = object_offset;
-
-    // Set mesh/object indexes on each object
-    for (uint16 i = 0; i < record.group.total; i++) {
-      auto& object = record.group[i];
-
-      object.mesh_index = mesh_index;
-      object.object_id = i;
+/**
+ * Finds a range of instance buffer slots for a group, reusing
+ * a range left behind by another group where one is large enough.
+ */
+static uint32 ReserveInstanceSlots(tMeshPack& pack, const uint32 total) {
+  auto& free_ranges = pack.free_instance_slot_ranges;
+
+  if (total == 0) {
+    return pack.total_instance_slots;
+  }
+
+  for (size_t i = 0; i < free_ranges.size(); i++) {
+    auto range = free_ranges[i];
+
+    if (range.total >= total) {
+      if (range.total == total) {
+        free_ranges[i] = free_ranges.back();
+        free_ranges.pop_back();
+      } else {
+        free_ranges[i].offset += total;
+        free_ranges[i].total -= total;
+      }
+
+      return range.offset;
     }
+  }
+
+  uint32 offset = pack.total_instance_slots;
+
+  pack.total_instance_slots += total;
+
+  return offset;
+}
+
+/**
+ * Gives an object group room for more objects. Existing objects keep
+ * their IDs; the new slots take the following IDs. Objects are never
+ * moved, so references to them remain valid. The group's instance
+ * buffer slots move to a new range, since growing in place would
+ * shift every later group, and the old range is reused later.
+ */
+static void GrowObjectGroup(Tachyon* tachyon, tMeshRecord& record, const uint16 total) {
+  auto& pack = tachyon->mesh_pack;
+  auto& group = record.group;
+
+  auto* surfaces = new uint32[total];
+  auto* matrices = new tMat4f[total];
+  auto* id_to_index = new uint16[total];
+
+  if (group.total > 0) {
+    std::copy_n(group.surfaces, group.total, surfaces);
+    std::copy_n(group.matrices, group.total, matrices);
+    std::copy_n(group.id_to_index, group.total, id_to_index);
+  }
+
+  ResizeObjectChunks(group, total);
+
+  for (uint16 i = group.total; i < total; i++) {
+    group[i].mesh_index = record.mesh_index;
+    group[i].object_id = i;
+    id_to_index[i] = i;
+  }
+
+  ReleaseInstanceSlots(pack, group.object_offset, group.total);
+  ReplaceObjectGroupStorage(group, surfaces, matrices, id_to_index, total);
+  SetObjectGroupOffset(record, ReserveInstanceSlots(pack, total));
+}
+
+/**
+ * Shrinks an object group to hold every object ID handed out so far,
+ * so handles remain valid, plus some room for new objects.
+ */
+static void CompactObjectGroup(tMeshRecord& record) {
+  auto& group = record.group;
+  uint32 total_used = group.total_active > 0 || group.highest_used_id > 0 ? group.highest_used_id + 1 : 0;
+  uint32 total = std::min(total_used + total_used / 4 + 16, 0xFFFFu);
+
+  // Groups may be filled after compaction, e.g. pooled
+  // projectiles, so never shrink below the declared total
+  total = std::max(total, uint32(group.declared_total));
+
+  if (total >= group.total) {
+    return;
+  }
+
+  auto* surfaces = new uint32[total];
+  auto* matrices = new tMat4f[total];
+  auto* id_to_index = new uint16[total];
+  std::vector<bool> is_id_active(total, false);
+
+  // Keep active objects where they are
+  for (uint16 i = 0; i < group.total_active; i++) {
+    auto id = group[i].object_id;
+
+    surfaces[i] = group.surfaces[i];
+    matrices[i] = group.matrices[i];
+    id_to_index[id] = i;
+    is_id_active[id] = true;
+  }
+
+  ResizeObjectChunks(group, total);
+
+  // Hand the remaining slots the IDs not in use
+  uint16 index = group.total_active;
+
+  for (uint16 id = 0; id < total; id++) {
+    if (!is_id_active[id]) {
+      group[index].mesh_index = record.mesh_index;
+      group[index].object_id = id;
+      id_to_index[id] = index;
+      index++;
+    }
+  }
+
+  ReplaceObjectGroupStorage(group, surfaces, matrices, id_to_index, uint16(total));
+}
+
+void Tachyon_InitializeObjects(Tachyon* tachyon) {
+  auto& pack = tachyon->mesh_pack;
+
+  pack.total_instance_slots = 0;
+  pack.free_instance_slot_ranges.clear();
+
+  for (auto& record : pack.mesh_records) {
+    uint16 total = record.group.total;
+
+    record.group.total = 0;
+
+    GrowObjectGroup(tachyon, record, total);
+  }
+}
+
+/**
+ * Shrinks every object group which has grown past the totals meshes
+ * were added with down to the objects actually created, and packs
+ * their instance buffer slots back together. Used after loading a
+ * level. Groups never shrink below their declared totals, since pools
+ * filled at runtime rely on them, and grow again as needed.
+ *
+ * Not suitable for scenes which write instances directly past their
+ * active objects.
+ */
+void Tachyon_CompactObjectGroups(Tachyon* tachyon) {
+  auto& pack = tachyon->mesh_pack;
+  uint32 object_offset = 0;
+
+  for (auto& record : pack.mesh_records) {
+    CompactObjectGroup(record);
+    SetObjectGroupOffset(record, object_offset);
 
     object_offset += record.group.total;
-    mesh_index++;
   }
+
+  pack.total_instance_slots = object_offset;
+  pack.free_instance_slot_ranges.clear();
 }
 
+/**
+ * Grows the object group when it is full. Objects are stored in
+ * chunks which never move, so references to previously created
+ * objects of the same mesh remain valid.
+ */
 tObject& Tachyon_CreateObject(Tachyon* tachyon, uint16 mesh_index) {
   auto& record = tachyon->mesh_pack.mesh_records[mesh_index];
   auto& group = record.group;
 
   if (group.total_active >= group.total) {
-    // @todo show the mesh name + limit
-    printf("[Tachyon_CreateObject] Fatal Error: Too many objects created for mesh %d (max %d)\n", mesh_index, group.total);
+    if (group.total == 0xFFFF) {
+      // @todo show the mesh name + limit
+      printf("[Tachyon_CreateObject] Fatal Error: Too many objects created for mesh %d (max %d)\n", mesh_index, group.total);
 
-    throw new std::exception("Error");
+      throw new std::exception("Error");
 
-    exit(0);
+      exit(0);
+    }
+
+    uint32 total = group.total < 8 ? 16 : uint32(group.total) * 2;
+
+    GrowObjectGroup(tachyon, record, uint16(std::min(total, 0xFFFFu)));
   }
 
   group.total_active++;
@@ -623,12 +836,12 @@ void Tachyon_RemoveObject(Tachyon* tachyon, uint16 mesh_index, uint16 object_id)
   uint16 last_active_index = group.total_active - 1;
 
   // Copy the last object in the active objects set
-  tObject last_active_object = group.objects[last_active_index];
+  tObject last_active_object = group[last_active_index];
   uint32 last_active_surface = group.surfaces[last_active_index];
   tMat4f last_active_matrix = group.matrices[last_active_index];
 
   // Move it to the removed index
-  group.objects[removed_index] = last_active_object;
+  group[removed_index] = last_active_object;
   group.surfaces[removed_index] = last_active_surface;
   group.matrices[removed_index] = last_active_matrix;
 
@@ -637,7 +850,7 @@ void Tachyon_RemoveObject(Tachyon* tachyon, uint16 mesh_index, uint16 object_id)
   group.id_to_index[removed_id] = last_active_index;
 
   // Copy the removed object ID over to its new position
-  group.objects[last_active_index].object_id = removed_id;
+  group[last_active_index].object_id = removed_id;
 
   // Truncate total active objects by 1
   group.total_active--;
@@ -671,7 +884,7 @@ void Tachyon_Commit(Tachyon* tachyon, const tObject& object) {
   auto index = group.id_to_index[object.object_id];
 
   group.surfaces[index] = (uint32(object.color.rgba) << 16) | (uint32)object.material.data;
-  group.matrices[index] = tMat4f::transformation(object.position, object.scale, object.rotation).transpose();
+  group.matrices[index] = tMat4f::transformation(Tachyon_GetRenderPosition(tachyon, object.origin, object.position), object.scale, object.rotation).transpose();
   group.buffered = false;
 }
 
@@ -688,7 +901,128 @@ tObject* Tachyon_GetLiveObject(Tachyon* tachyon, const tObject& object) {
     return nullptr;
   }
 
-  return &group.objects[index];
+  return &group[index];
+}
+
+static inline tVec3f GetRelativePosition(const tVec3d& render_origin, const tVec3d& origin, const tVec3f& position) {
+  return (origin - render_origin + tVec3d(position)).toVec3f();
+}
+
+/**
+ * Snaps a world position to a coarse grid, so render origins only
+ * take on a limited set of values.
+ */
+static tVec3d GetSnappedRenderOrigin(const tVec3d& position) {
+  constexpr static double REBASE_GRID_SIZE = 4096.0;
+
+  return tVec3d(
+    round(position.x / REBASE_GRID_SIZE) * REBASE_GRID_SIZE,
+    round(position.y / REBASE_GRID_SIZE) * REBASE_GRID_SIZE,
+    round(position.z / REBASE_GRID_SIZE) * REBASE_GRID_SIZE
+  );
+}
+
+/**
+ * Returns a world position, given as a double-precision origin
+ * and a local offset, relative to the render origin.
+ */
+tVec3f Tachyon_GetRenderPosition(Tachyon* tachyon, const tVec3d& origin, const tVec3f& position) {
+  return GetRelativePosition(tachyon->scene.render_origin, origin, position);
+}
+
+/**
+ * Moves the render origin close to a world position, once it is further
+ * than REBASE_DISTANCE away, and rewrites every active object's matrix
+ * translation relative to the new origin. Translations are rebuilt from
+ * the objects' double-precision world positions, rather than shifted,
+ * so objects near the new origin keep full precision.
+ */
+void Tachyon_RebaseRenderOrigin(Tachyon* tachyon, const tVec3d& position) {
+  constexpr static double REBASE_DISTANCE = 50000.0;
+
+  auto& scene = tachyon->scene;
+
+  if ((position - scene.render_origin).magnitude() < REBASE_DISTANCE) {
+    return;
+  }
+
+  scene.render_origin = GetSnappedRenderOrigin(position);
+
+  for (auto& record : tachyon->mesh_pack.mesh_records) {
+    auto& group = record.group;
+
+    if (group.total_active == 0) {
+      continue;
+    }
+
+    // Matrices are stored transposed, with translation in the last row
+    for (uint16 i = 0; i < group.total_active; i++) {
+      auto& object = group[i];
+      auto& m = group.matrices[i].m;
+      tVec3f translation = GetRelativePosition(scene.render_origin, object.origin, object.position);
+
+      m[12] = translation.x;
+      m[13] = translation.y;
+      m[14] = translation.z;
+    }
+
+    group.buffered = false;
+  }
+}
+
+/**
+ * Checks that an object 10^7 units from the world origin still gets
+ * a sub-millimeter-accurate matrix translation, when the render origin
+ * is rebased near it. Stops with a fatal error otherwise.
+ */
+void Tachyon_CheckRenderOriginPrecision() {
+  constexpr static double FAR_DISTANCE = 10000000.0;
+  constexpr static double MAX_ERROR = 0.001;
+
+  tVec3d object_origin = tVec3d(FAR_DISTANCE, -FAR_DISTANCE, FAR_DISTANCE);
+  tVec3f object_position = tVec3f(1.2345f, 0.0625f, -3.3333f);
+  tVec3d camera_position = object_origin + tVec3d(tVec3f(1000.f, 2000.f, 3000.f));
+  tVec3d render_origin = GetSnappedRenderOrigin(camera_position);
+
+  // Build the matrix the same way Tachyon_Commit() does
+  tVec3f translation = GetRelativePosition(render_origin, object_origin, object_position);
+  tMat4f matrix = tMat4f::transformation(translation, tVec3f(1.f), Quaternion(1.f, 0, 0, 0)).transpose();
+
+  tVec3d committed_position = render_origin + tVec3d(tVec3f(matrix.m[12], matrix.m[13], matrix.m[14]));
+  tVec3d expected_position = object_origin + tVec3d(object_position);
+  double error = (committed_position - expected_position).magnitude();
+
+  if (error > MAX_ERROR) {
+    printf("[Tachyon_CheckRenderOriginPrecision] Fatal Error: Translation error of %f at %.0f units\n", error, FAR_DISTANCE);
+
+    throw new std::exception("Error");
+
+    exit(0);
+  }
+}
+
+/**
+ * Returns the local-space bounds of a mesh's highest level of detail.
+ */
+tBounds Tachyon_GetMeshBounds(Tachyon* tachyon, uint16 mesh_index) {
+  auto& geometry = tachyon->mesh_pack.mesh_records[mesh_index].lod_1;
+  auto& vertices = tachyon->mesh_pack.vertex_stream;
+  tBounds bounds = { tVec3f(0.f), tVec3f(0.f) };
+
+  for (uint32 i = geometry.vertex_start; i < geometry.vertex_end; i++) {
+    auto& position = vertices[i].position;
+
+    if (i == geometry.vertex_start) {
+      bounds.min = bounds.max = position;
+
+      continue;
+    }
+
+    bounds.min = tVec3f(std::min(bounds.min.x, position.x), std::min(bounds.min.y, position.y), std::min(bounds.min.z, position.z));
+    bounds.max = tVec3f(std::max(bounds.max.x, position.x), std::max(bounds.max.y, position.y), std::max(bounds.max.z, position.z));
+  }
+
+  return bounds;
 }
 
 uint16 Tachyon_PartitionObjectsByDistance(Tachyon* tachyon, tObjectGroup& group, const uint16 start, const float distance) {
@@ -699,7 +1033,7 @@ uint16 Tachyon_PartitionObjectsByDistance(Tachyon* tachyon, tObjectGroup& group,
   // Partition objects in a group in linear time, by distance from the camera.
   // We independently count up and count down until our counters meet.
   while (current < end) {
-    auto object_a = group.objects[current];
+    auto object_a = group[current];
     auto object_a_distance = (object_a.position - camera.position).magnitude();
 
     if (object_a_distance <= distance) {
@@ -712,12 +1046,12 @@ uint16 Tachyon_PartitionObjectsByDistance(Tachyon* tachyon, tObjectGroup& group,
       // Count down until we find an object B on the wrong side of the pivot,
       // and swap it with object A.
       do {
-        object_b = group.objects[--end];
+        object_b = group[--end];
         object_b_distance = (object_b.position - camera.position).magnitude();
       } while (object_b_distance > distance && current < end);
 
       if (current != end) {
-        std::swap(group.objects[current], group.objects[end]);
+        std::swap(group[current], group[end]);
         std::swap(group.matrices[current], group.matrices[end]);
         std::swap(group.surfaces[current], group.surfaces[end]);
         std::swap(group.id_to_index[object_a.object_id], group.id_to_index[object_b.object_id]);
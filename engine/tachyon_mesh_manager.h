@@ -1,5 +1,6 @@
 #pragma once
 
+#include "engine/tachyon_bvh.h"
 #include "engine/tachyon_linear_algebra.h"
 #include "engine/tachyon_types.h"
 
@@ -41,8 +42,10 @@ uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh, uint16 total);
 uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh, const tMesh& mesh2, uint16 total);
 uint16 Tachyon_AddMesh(Tachyon* tachyon, const tMesh& mesh, const tMesh& mesh2, const tMesh& mesh3, uint16 total);
 int32 Tachyon_AddVertexStream(Tachyon* tachyon);
+void Tachyon_PatchVertexStream(tVertexStream& stream, const uint32 vertex_start, const uint32 total_vertices, const uint32 element_start, const uint32 total_elements);
 int32 Tachyon_AddSkinnedMesh(Tachyon* tachyon, const tSkinnedMesh& skinned_mesh);
 void Tachyon_InitializeObjects(Tachyon* tachyon);
+void Tachyon_CompactObjectGroups(Tachyon* tachyon);
 tObject& Tachyon_CreateObject(Tachyon* tachyon, uint16 mesh_index);
 void Tachyon_RemoveObject(Tachyon* tachyon, uint16 mesh_index, uint16 object_id);
 void Tachyon_RemoveObject(Tachyon* tachyon, tObject& object);
@@ -50,6 +53,10 @@ void Tachyon_RemoveAllObjects(Tachyon* tachyon, uint16 mesh_index);
 void Tachyon_Commit(Tachyon* tachyon, const tObject& object);
 void Tachyon_Commit(Tachyon* tachyon, tSkinnedMesh& skinned_mesh);
 tObject* Tachyon_GetLiveObject(Tachyon* tachyon, const tObject& object);
+tVec3f Tachyon_GetRenderPosition(Tachyon* tachyon, const tVec3d& origin, const tVec3f& position);
+void Tachyon_RebaseRenderOrigin(Tachyon* tachyon, const tVec3d& position);
+void Tachyon_CheckRenderOriginPrecision();
+tBounds Tachyon_GetMeshBounds(Tachyon* tachyon, uint16 mesh_index);
 uint16 Tachyon_PartitionObjectsByDistance(Tachyon* tachyon, tObjectGroup& group, const uint16 start, const float distance);
 void Tachyon_UseLodByDistance(Tachyon* tachyon, const uint16 mesh_index, const float distance);
 void Tachyon_UseLodByDistance(Tachyon* tachyon, const uint16 mesh_index, const float distance, const float distance2);
@@ -0,0 +1,110 @@
+#include "engine/tachyon_mesh_manager.h"
+#include "engine/tachyon_particles.h"
+
+void Tachyon_InitParticlePool(tParticlePool& pool, const uint32 total) {
+  pool.positions.resize(total);
+  pool.velocities.resize(total);
+  pool.origins.resize(total);
+  pool.spawn_times.resize(total);
+  pool.lifetimes.resize(total);
+  pool.owner_ids.resize(total);
+  pool.handles.resize(total);
+
+  pool.owner_particle_counts.clear();
+
+  pool.total = total;
+  pool.total_active = 0;
+}
+
+/**
+ * Returns the index of the spawned particle, or -1 if the pool is full.
+ */
+int32 Tachyon_SpawnParticle(tParticlePool& pool, const int32 owner_id, const tVec3f& position, const tVec3f& velocity, const float spawn_time, const float lifetime, const int32 handle) {
+  if (pool.total_active >= pool.total) {
+    return -1;
+  }
+
+  uint32 index = pool.total_active++;
+
+  pool.positions[index] = position;
+  pool.velocities[index] = velocity;
+  pool.origins[index] = position;
+  pool.spawn_times[index] = spawn_time;
+  pool.lifetimes[index] = lifetime;
+  pool.owner_ids[index] = owner_id;
+  pool.handles[index] = handle;
+
+  pool.owner_particle_counts[owner_id]++;
+
+  return index;
+}
+
+/**
+ * Moves the last active particle into the killed particle's slot.
+ * When killing particles during iteration, iterate in reverse so
+ * the moved particle has already been visited.
+ */
+void Tachyon_KillParticle(tParticlePool& pool, const uint32 index) {
+  if (index >= pool.total_active) {
+    return;
+  }
+
+  auto owner_count = pool.owner_particle_counts.find(pool.owner_ids[index]);
+
+  if (owner_count != pool.owner_particle_counts.end() && --owner_count->second == 0) {
+    pool.owner_particle_counts.erase(owner_count);
+  }
+
+  uint32 last = --pool.total_active;
+
+  if (index != last) {
+    pool.positions[index] = pool.positions[last];
+    pool.velocities[index] = pool.velocities[last];
+    pool.origins[index] = pool.origins[last];
+    pool.spawn_times[index] = pool.spawn_times[last];
+    pool.lifetimes[index] = pool.lifetimes[last];
+    pool.owner_ids[index] = pool.owner_ids[last];
+    pool.handles[index] = pool.handles[last];
+  }
+}
+
+bool Tachyon_EmitterHasParticles(const tParticlePool& pool, const int32 owner_id) {
+  return pool.owner_particle_counts.find(owner_id) != pool.owner_particle_counts.end();
+}
+
+void Tachyon_IntegrateParticles(tParticlePool& pool, const float dt) {
+  auto* positions = pool.positions.data();
+  auto* velocities = pool.velocities.data();
+
+  for (uint32 i = 0; i < pool.total_active; i++) {
+    positions[i].x += velocities[i].x * dt;
+    positions[i].y += velocities[i].y * dt;
+    positions[i].z += velocities[i].z * dt;
+  }
+}
+
+/**
+ * Shows one instance of a mesh at each active particle, in a single
+ * pass over the pool. The mesh's objects must be created up front,
+ * as many as there are particles to show; any further particles
+ * are not shown.
+ */
+void Tachyon_CommitParticleInstances(Tachyon* tachyon, const tParticlePool& pool, const uint16 mesh_index, const tVec3f& scale, const tColor& color, const tMaterial& material) {
+  auto& group = objects(mesh_index);
+  uint32 total_instances = pool.total_active < group.total_active ? pool.total_active : group.total_active;
+  Quaternion rotation = Quaternion(1.f, 0, 0, 0);
+
+  reset_instances(mesh_index);
+
+  for (uint32 i = 0; i < total_instances; i++) {
+    auto& object = use_instance(mesh_index);
+
+    object.position = pool.positions[i];
+    object.scale = scale;
+    object.rotation = rotation;
+    object.color = color;
+    object.material = material;
+
+    commit(object);
+  }
+}
\ No newline at end of file
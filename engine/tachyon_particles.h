@@ -0,0 +1,39 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "engine/tachyon_types.h"
+
+/**
+ * ----------------------------
+ * A fixed-capacity pool of particles, stored as parallel arrays.
+ * Active particles are always packed into [0, total_active), so
+ * spawning appends and killing swaps the last particle into the
+ * killed particle's slot.
+ * ----------------------------
+ */
+struct tParticlePool {
+  std::vector<tVec3f> positions;
+  std::vector<tVec3f> velocities;
+  std::vector<tVec3f> origins;
+  std::vector<float> spawn_times;
+  std::vector<float> lifetimes;
+  // The id of the emitter which spawned each particle
+  std::vector<int32> owner_ids;
+  // An optional external handle per particle, e.g. a point light id
+  std::vector<int32> handles;
+
+  // Active particle counts per emitter id
+  std::unordered_map<int32, uint32> owner_particle_counts;
+
+  uint32 total = 0;
+  uint32 total_active = 0;
+};
+
+void Tachyon_InitParticlePool(tParticlePool& pool, const uint32 total);
+int32 Tachyon_SpawnParticle(tParticlePool& pool, const int32 owner_id, const tVec3f& position, const tVec3f& velocity, const float spawn_time, const float lifetime, const int32 handle = -1);
+void Tachyon_KillParticle(tParticlePool& pool, const uint32 index);
+bool Tachyon_EmitterHasParticles(const tParticlePool& pool, const int32 owner_id);
+void Tachyon_IntegrateParticles(tParticlePool& pool, const float dt);
+void Tachyon_CommitParticleInstances(Tachyon* tachyon, const tParticlePool& pool, const uint16 mesh_index, const tVec3f& scale, const tColor& color, const tMaterial& material);
\ No newline at end of file
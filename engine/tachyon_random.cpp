@@ -13,7 +13,11 @@ tRNG::tRNG(float seed) {
 }
 
 float tRNG::Random() {
-  return unit_distribution(engine);
+  // Use a local distribution, so separate RNG instances
+  // can be used safely from multiple threads
+  std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+  return distribution(engine);
 }
 
 float tRNG::Random(float low, float high) {
@@ -0,0 +1,165 @@
+#include <math.h>
+
+#include "engine/tachyon_spatial_grid.h"
+
+static inline int32 GetCellCoordinate(const float value, const float cell_size) {
+  return (int32)floorf(value / cell_size);
+}
+
+static inline int32 GetCellY(const tSpatialGrid& grid, const float y) {
+  return grid.use_vertical_cells ? GetCellCoordinate(y, grid.cell_size) : 0;
+}
+
+static inline uint32 HashCell(const int32 x, const int32 y, const int32 z, const uint32 total_cells) {
+  uint32 h = (uint32(x) * 73856093) ^ (uint32(y) * 83492791) ^ (uint32(z) * 19349663);
+
+  return h % total_cells;
+}
+
+void Tachyon_BuildSpatialGrid(tSpatialGrid& grid, const std::vector<tVec3f>& points, const float cell_size) {
+  uint32 total_points = (uint32)points.size();
+
+  grid.cell_size = cell_size;
+  grid.points = points;
+  grid.point_cells.resize(total_points);
+  grid.cell_items.resize(total_points);
+  grid.cell_starts.assign(grid.total_cells + 1, 0);
+
+  // Count points per cell
+  for (uint32 i = 0; i < total_points; i++) {
+    int32 x = GetCellCoordinate(points[i].x, cell_size);
+    int32 y = GetCellY(grid, points[i].y);
+    int32 z = GetCellCoordinate(points[i].z, cell_size);
+    uint32 cell = HashCell(x, y, z, grid.total_cells);
+
+    grid.point_cells[i] = cell;
+    grid.cell_starts[cell + 1]++;
+  }
+
+  // Convert counts to offsets
+  for (uint32 i = 0; i < grid.total_cells; i++) {
+    grid.cell_starts[i + 1] += grid.cell_starts[i];
+  }
+
+  // Scatter point indexes into their cells, preserving point order
+  // @allocation
+  std::vector<uint32> cell_offsets(grid.cell_starts.begin(), grid.cell_starts.end() - 1);
+
+  for (uint32 i = 0; i < total_points; i++) {
+    grid.cell_items[cell_offsets[grid.point_cells[i]]++] = i;
+  }
+}
+
+void Tachyon_QuerySpatialGrid(const tSpatialGrid& grid, const tVec3f& position, const float radius, std::vector<uint32>& results) {
+  results.clear();
+
+  if (grid.points.size() == 0) {
+    return;
+  }
+
+  float cell_size = grid.cell_size;
+  float radius_squared = radius * radius;
+  int32 min_x = GetCellCoordinate(position.x - radius, cell_size);
+  int32 max_x = GetCellCoordinate(position.x + radius, cell_size);
+  int32 min_y = GetCellY(grid, position.y - radius);
+  int32 max_y = GetCellY(grid, position.y + radius);
+  int32 min_z = GetCellCoordinate(position.z - radius, cell_size);
+  int32 max_z = GetCellCoordinate(position.z + radius, cell_size);
+
+  for (int32 x = min_x; x <= max_x; x++) {
+    for (int32 y = min_y; y <= max_y; y++) {
+      for (int32 z = min_z; z <= max_z; z++) {
+        uint32 cell = HashCell(x, y, z, grid.total_cells);
+
+        for (uint32 i = grid.cell_starts[cell]; i < grid.cell_starts[cell + 1]; i++) {
+          uint32 index = grid.cell_items[i];
+          auto& point = grid.points[index];
+
+          // Skip points which only share this cell's hash
+          if (
+            GetCellCoordinate(point.x, cell_size) != x ||
+            GetCellY(grid, point.y) != y ||
+            GetCellCoordinate(point.z, cell_size) != z
+          ) {
+            continue;
+          }
+
+          float dx = point.x - position.x;
+          float dy = point.y - position.y;
+          float dz = point.z - position.z;
+
+          if (dx * dx + dy * dy + dz * dz <= radius_squared) {
+            results.push_back(index);
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Finds points within a square on the xz plane, at any height.
+ * Only meaningful for grids without vertical cells.
+ */
+void Tachyon_QuerySpatialGridBox(const tSpatialGrid& grid, const tVec3f& position, const float half_size, std::vector<uint32>& results) {
+  results.clear();
+
+  if (grid.points.size() == 0) {
+    return;
+  }
+
+  float cell_size = grid.cell_size;
+  int32 min_x = GetCellCoordinate(position.x - half_size, cell_size);
+  int32 max_x = GetCellCoordinate(position.x + half_size, cell_size);
+  int32 min_z = GetCellCoordinate(position.z - half_size, cell_size);
+  int32 max_z = GetCellCoordinate(position.z + half_size, cell_size);
+
+  for (int32 x = min_x; x <= max_x; x++) {
+    for (int32 z = min_z; z <= max_z; z++) {
+      uint32 cell = HashCell(x, 0, z, grid.total_cells);
+
+      for (uint32 i = grid.cell_starts[cell]; i < grid.cell_starts[cell + 1]; i++) {
+        uint32 index = grid.cell_items[i];
+        auto& point = grid.points[index];
+
+        // Skip points which only share this cell's hash
+        if (
+          GetCellCoordinate(point.x, cell_size) != x ||
+          GetCellCoordinate(point.z, cell_size) != z
+        ) {
+          continue;
+        }
+
+        if (
+          fabsf(point.x - position.x) <= half_size &&
+          fabsf(point.z - position.z) <= half_size
+        ) {
+          results.push_back(index);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Finds points within a radius whose direction from the query
+ * position is within a cone, expressed as the minimum dot product
+ * against the (unit) cone direction.
+ */
+void Tachyon_QuerySpatialGridCone(const tSpatialGrid& grid, const tVec3f& position, const tVec3f& direction, const float radius, const float min_dot, std::vector<uint32>& results) {
+  Tachyon_QuerySpatialGrid(grid, position, radius, results);
+
+  uint32 total_results = 0;
+
+  for (auto index : results) {
+    tVec3f offset = grid.points[index] - position;
+    float distance = offset.magnitude();
+
+    // Points at the query position are considered inside the cone
+    if (distance == 0.f || tVec3f::dot(direction, offset) >= min_dot * distance) {
+      results[total_results++] = index;
+    }
+  }
+
+  results.resize(total_results);
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "engine/tachyon_aliases.h"
+#include "engine/tachyon_linear_algebra.h"
+
+/**
+ * ----------------------------
+ * A uniform grid over the xz plane, for neighbor queries
+ * against sets of moving points. The grid is rebuilt from
+ * scratch whenever the points move, using a counting sort
+ * into a fixed number of hashed cells, so it works for
+ * unbounded worlds without any per-cell allocations.
+ * ----------------------------
+ */
+struct tSpatialGrid {
+  float cell_size = 1000.f;
+  uint32 total_cells = 4096;
+  // Divide cells along y as well, for points spread out
+  // vertically, which would otherwise pile into xz cells
+  bool use_vertical_cells = false;
+
+  std::vector<tVec3f> points;
+  // Offsets into cell_items for each cell, plus one past the end
+  std::vector<uint32> cell_starts;
+  // Point indexes, ordered by cell
+  std::vector<uint32> cell_items;
+  // The hashed cell for each point
+  std::vector<uint32> point_cells;
+};
+
+void Tachyon_BuildSpatialGrid(tSpatialGrid& grid, const std::vector<tVec3f>& points, const float cell_size);
+void Tachyon_QuerySpatialGrid(const tSpatialGrid& grid, const tVec3f& position, const float radius, std::vector<uint32>& results);
+void Tachyon_QuerySpatialGridBox(const tSpatialGrid& grid, const tVec3f& position, const float half_size, std::vector<uint32>& results);
+void Tachyon_QuerySpatialGridCone(const tSpatialGrid& grid, const tVec3f& position, const tVec3f& direction, const float radius, const float min_dot, std::vector<uint32>& results);
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "engine/tachyon_jobs.h"
+#include "engine/tachyon_systems.h"
+#include "engine/tachyon_timer.h"
+
+static bool HasOverlap(const std::vector<const void*>& a, const std::vector<const void*>& b) {
+  for (auto* x : a) {
+    for (auto* y : b) {
+      if (x == y) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+static bool HasConflict(const tSystem& a, const tSystem& b) {
+  return (
+    HasOverlap(a.writes, b.writes) ||
+    HasOverlap(a.writes, b.reads) ||
+    HasOverlap(a.reads, b.writes)
+  );
+}
+
+static void RunSystem(tSystem& system) {
+  uint64 start_time = Tachyon_GetMicroseconds();
+
+  system.run();
+
+  system.last_duration = Tachyon_GetMicroseconds() - start_time;
+}
+
+void Tachyon_AddSystem(tSystemGraph& graph, const tSystem& system) {
+  graph.systems.push_back(system);
+}
+
+void Tachyon_BuildSystemGraph(tSystemGraph& graph) {
+  graph.stages.clear();
+
+  for (uint32 i = 0; i < graph.systems.size(); i++) {
+    auto& system = graph.systems[i];
+
+    system.stage = 0;
+
+    for (uint32 j = 0; j < i; j++) {
+      auto& previous = graph.systems[j];
+
+      if (HasConflict(previous, system) && previous.stage + 1 > system.stage) {
+        system.stage = previous.stage + 1;
+      }
+    }
+
+    if (system.stage >= graph.stages.size()) {
+      graph.stages.resize(system.stage + 1);
+    }
+
+    graph.stages[system.stage].push_back(i);
+  }
+}
+
+/**
+ * Runs each stage's systems in parallel, followed by their
+ * commit steps in declaration order. System timings are
+ * recorded to the profiler on the calling thread, in
+ * declaration order, so the profile is stable frame to frame.
+ */
+void Tachyon_RunSystemGraph(tSystemGraph& graph) {
+  if (graph.run_serially) {
+    for (auto& system : graph.systems) {
+      RunSystem(system);
+
+      if (system.commit) {
+        system.commit();
+      }
+    }
+  } else {
+    for (auto& stage : graph.stages) {
+      parallel_for((uint32)stage.size(), [&](uint32 i) {
+        RunSystem(graph.systems[stage[i]]);
+      });
+
+      for (auto index : stage) {
+        auto& system = graph.systems[index];
+
+        if (system.commit) {
+          system.commit();
+        }
+      }
+    }
+  }
+
+  for (auto& system : graph.systems) {
+    Tachyon_RecordTiming(system.name, system.last_duration);
+  }
+}
\ No newline at end of file
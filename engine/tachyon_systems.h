@@ -0,0 +1,45 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "engine/tachyon_aliases.h"
+
+/**
+ * ----------------------------
+ * A per-frame system, declaring the data it reads and writes
+ * by address. Systems which don't conflict with one another may
+ * run in parallel; the optional commit step always runs on the
+ * calling thread, for work which touches shared engine state.
+ * ----------------------------
+ */
+struct tSystem {
+  std::string name;
+  std::function<void()> run;
+  std::function<void()> commit;
+  std::vector<const void*> reads;
+  std::vector<const void*> writes;
+
+  uint32 stage = 0;
+  uint64 last_duration = 0;
+};
+
+/**
+ * ----------------------------
+ * A list of systems grouped into stages. Each system is placed
+ * one stage after the latest earlier-declared system it conflicts
+ * with, so running stages in order, and commits in declaration
+ * order after each stage, produces the same results as running
+ * every system serially in declaration order.
+ * ----------------------------
+ */
+struct tSystemGraph {
+  std::vector<tSystem> systems;
+  std::vector<std::vector<uint32>> stages;
+  bool run_serially = false;
+};
+
+void Tachyon_AddSystem(tSystemGraph& graph, const tSystem& system);
+void Tachyon_BuildSystemGraph(tSystemGraph& graph);
+void Tachyon_RunSystemGraph(tSystemGraph& graph);
\ No newline at end of file
@@ -1,9 +1,14 @@
 #include <chrono>
+#include <mutex>
 
 #include "engine/tachyon_aliases.h"
 #include "engine/tachyon_timer.h"
 
 static std::vector<tRecordedTiming> recorded_timings;
+// Timings are recorded from job threads (e.g. entity types which
+// time-evolve in parallel) and from background threads (e.g. the
+// procedural rebuild worker), not just the main thread
+static std::mutex recorded_timings_mutex;
 
 uint64 Tachyon_GetMicroseconds() {
   auto now = std::chrono::system_clock::now();
@@ -12,10 +17,14 @@ uint64 Tachyon_GetMicroseconds() {
 }
 
 void Tachyon_ResetTimingProfile() {
+  std::lock_guard<std::mutex> lock(recorded_timings_mutex);
+
   recorded_timings.clear();
 }
 
 void Tachyon_RecordTiming(const std::string& name, const uint64 duration) {
+  std::lock_guard<std::mutex> lock(recorded_timings_mutex);
+
   recorded_timings.push_back({ name, duration });
 }
 
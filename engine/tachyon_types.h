@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iterator>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -54,6 +55,9 @@ struct tMaterial {
 };
 
 struct tObject {
+  // Double-precision origin which position is relative to. Objects far
+  // from the world origin can keep position small, and precise.
+  tVec3d origin;
   tVec3f position;
   tVec3f scale;
   Quaternion rotation = Quaternion(1.f, 0, 0, 0);
@@ -68,8 +72,49 @@ struct tObject {
   }
 };
 
+// Objects are allocated in chunks of this size, which never
+// move, so growing a group keeps references to its objects valid
+constexpr static uint16 OBJECT_CHUNK_SIZE = 256;
+
 struct tObjectGroup {
-  tObject* objects = nullptr;
+  struct iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = tObject;
+    using difference_type = std::ptrdiff_t;
+    using pointer = tObject*;
+    using reference = tObject&;
+
+    const tObjectGroup* group;
+    uint16 index;
+
+    tObject& operator*() const {
+      return (*group)[index];
+    }
+
+    iterator& operator++() {
+      index++;
+
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator previous = *this;
+
+      index++;
+
+      return previous;
+    }
+
+    bool operator==(const iterator& other) const {
+      return index == other.index;
+    }
+
+    bool operator!=(const iterator& other) const {
+      return index != other.index;
+    }
+  };
+
+  std::vector<tObject*> object_chunks;
   uint32* surfaces = nullptr;
   tMat4f* matrices = nullptr;
   uint16* id_to_index = nullptr;
@@ -77,22 +122,24 @@ struct tObjectGroup {
   uint16 total = 0;
   uint16 total_active = 0;
   uint16 highest_used_id = 0;
+  // The total the mesh was added with
+  uint16 declared_total = 0;
   bool buffered = false;
   bool disabled = false;
 
   std::vector<tObject> initial_objects;
 
-  tObject& operator [](uint16 index) {
+  tObject& operator [](uint16 index) const {
     // @todo assert index is in range
-    return objects[index];
+    return object_chunks[index / OBJECT_CHUNK_SIZE][index % OBJECT_CHUNK_SIZE];
   }
 
-  tObject* begin() const {
-    return objects;
+  iterator begin() const {
+    return { this, 0 };
   }
 
-  tObject* end() const {
-    return &objects[total_active];
+  iterator end() const {
+    return { this, total_active };
   }
 
   tObject* getById(uint16 id) const {
@@ -106,13 +153,13 @@ struct tObjectGroup {
       return nullptr;
     }
 
-    return &objects[index];
+    return &(*this)[index];
   }
 
   tObject& getByIdFast(uint16 id) const {
     auto index = id_to_index[id];
 
-    return objects[index];
+    return (*this)[index];
   }
 };
 
@@ -124,6 +171,13 @@ struct tVertexStream {
   tMaterial material = tVec4f(0.6f, 0, 0, 0);
 
   bool buffered = false;
+
+  // Ranges changed since the stream was buffered, which are
+  // uploaded in place rather than re-uploading the whole stream
+  uint32 patched_vertices_start = 0;
+  uint32 patched_vertices_end = 0;
+  uint32 patched_elements_start = 0;
+  uint32 patched_elements_end = 0;
 };
 
 struct tBone {
@@ -186,10 +240,20 @@ struct tMeshRecord {
   tObjectGroup group;
 };
 
+struct tInstanceSlotRange {
+  uint32 offset = 0;
+  uint32 total = 0;
+};
+
 struct tMeshPack {
   std::vector<tVertex> vertex_stream;
   std::vector<uint32> face_element_stream;
   std::vector<tMeshRecord> mesh_records;
+  // Instance buffer slots reserved across all object groups
+  uint32 total_instance_slots = 0;
+  // Instance buffer slot ranges left behind by groups which grew,
+  // reused by groups growing later
+  std::vector<tInstanceSlotRange> free_instance_slot_ranges;
 };
 
 struct tSkinnedVertex : tVertex {
@@ -278,9 +342,6 @@ struct Tachyon {
 
   // Static meshes
   tMeshPack mesh_pack;
-  std::vector<tObject> objects;
-  std::vector<uint32> surfaces;
-  std::vector<tMat4f> matrices;
 
   // Procedural geometry
   std::vector<tVertexStream> vertex_streams;
@@ -320,7 +381,12 @@ struct Tachyon {
     tCamera camera;
     tCamera3p camera3p;
 
+    // Relative to camera.origin, like camera.position
     tVec3f transform_origin = tVec3f(0.f);
+    // Object matrices are stored relative to this point, so
+    // instance translations stay small close to it. Only moved
+    // by Tachyon_RebaseRenderOrigin().
+    tVec3d render_origin;
     float scene_time = 0.f;
 
     float z_near = 500.f;
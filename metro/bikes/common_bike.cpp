@@ -72,63 +72,82 @@ void CommonBike::HandlePhysics(Tachyon* tachyon, State& state, Bicycle& bike) {
     const float front_wheel_ground_distance = 800.f - bike.recoil;
     const float back_wheel_ground_distance = 820.f;
 
-    for_static_entity_containers() {
-      for_entities() {
-        // @todo skip collision checks against out-of-range entities
-
-        for (auto& plane : entity.collision_planes) {
-          if (
-            bike.position.y > plane.max_y + ray_length ||
-            bike.position.y < plane.min_y
-          ) {
-            // Skip collision checks against planes below or above the bike
-            continue;
-          }
-
-          tVec3f start_offset = plane.normal * above_wheel_buffer;
-          tVec3f front_ray_start = bike.front_wheel_position + start_offset;
-          tVec3f back_ray_start = bike.back_wheel_position + start_offset;
-          tVec3f down_ray = plane.normal.invert() * ray_length;
-
-          auto front = Collision::TestRayHit(front_ray_start, down_ray, plane);
-          auto back = Collision::TestRayHit(back_ray_start, down_ray, plane);
-
-          if (front.has_collision) {
-            float force_dot = tVec3f::dot(bike.facing_direction, plane.normal);
-
-            if (bike.jumping_off_ramp && force_dot >= 0.f) {
-              // If the bike is jumping off a ramp, and its horizontal force direction
-              // is pointing outward from, or parallel to this plane, don't collide it
-              // with the front wheel. For example, the flat plane at the top of a ramp
-              // shouldn't "snap" the front wheel down as the bike launches off that ramp.
-              continue;
-            }
-
-            tVec3f resolved_position = front.collision_point + plane.normal * front_wheel_ground_distance;
-
-            if (resolved_position.y > highest_front_y) {
-              ideal_front_wheel_position = resolved_position;
-              highest_front_y = resolved_position.y;
-              front_wheel_plane_normal = plane.normal;
-            }
-          }
-
-          if (back.has_collision) {
-            float force_dot = tVec3f::dot(bike.facing_direction, plane.normal);
-
-            if (bike.jumping_off_ramp && force_dot >= 0.f) {
-              // Same principle as the front wheel collision restriction above
-              continue;
-            }
-
-            tVec3f resolved_position = back.collision_point + plane.normal * back_wheel_ground_distance;
-
-            if (resolved_position.y > highest_back_y) {
-              ideal_back_wheel_position = resolved_position;
-              highest_back_y = resolved_position.y;
-              back_wheel_plane_normal = plane.normal;
-            }
-          }
+    // Find planes near both wheels in a single query. Each wheel ray
+    // stays within (above_wheel_buffer + ray_length) of its wheel.
+    const float query_radius = above_wheel_buffer + ray_length;
+
+    auto front_bounds = Tachyon_GetSphereBounds(bike.front_wheel_position, query_radius);
+    auto back_bounds = Tachyon_GetSphereBounds(bike.back_wheel_position, query_radius);
+
+    tBounds query_bounds = {
+      .min = tVec3f(
+        std::min(front_bounds.min.x, back_bounds.min.x),
+        std::min(front_bounds.min.y, back_bounds.min.y),
+        std::min(front_bounds.min.z, back_bounds.min.z)
+      ),
+      .max = tVec3f(
+        std::max(front_bounds.max.x, back_bounds.max.x),
+        std::max(front_bounds.max.y, back_bounds.max.y),
+        std::max(front_bounds.max.z, back_bounds.max.z)
+      )
+    };
+
+    auto& planes = state.collision_planes.planes;
+    auto& nearby_planes = Collision::QueryCollisionPlanes(state.collision_planes, query_bounds);
+
+    for (auto plane_index : nearby_planes) {
+      auto& plane = planes[plane_index];
+
+      if (
+        bike.position.y > plane.max_y + ray_length ||
+        bike.position.y < plane.min_y
+      ) {
+        // Skip collision checks against planes below or above the bike
+        continue;
+      }
+
+      tVec3f start_offset = plane.normal * above_wheel_buffer;
+      tVec3f front_ray_start = bike.front_wheel_position + start_offset;
+      tVec3f back_ray_start = bike.back_wheel_position + start_offset;
+      tVec3f down_ray = plane.normal.invert() * ray_length;
+
+      auto front = Collision::TestRayHit(front_ray_start, down_ray, plane);
+      auto back = Collision::TestRayHit(back_ray_start, down_ray, plane);
+
+      if (front.has_collision) {
+        float force_dot = tVec3f::dot(bike.facing_direction, plane.normal);
+
+        if (bike.jumping_off_ramp && force_dot >= 0.f) {
+          // If the bike is jumping off a ramp, and its horizontal force direction
+          // is pointing outward from, or parallel to this plane, don't collide it
+          // with the front wheel. For example, the flat plane at the top of a ramp
+          // shouldn't "snap" the front wheel down as the bike launches off that ramp.
+          continue;
+        }
+
+        tVec3f resolved_position = front.collision_point + plane.normal * front_wheel_ground_distance;
+
+        if (resolved_position.y > highest_front_y) {
+          ideal_front_wheel_position = resolved_position;
+          highest_front_y = resolved_position.y;
+          front_wheel_plane_normal = plane.normal;
+        }
+      }
+
+      if (back.has_collision) {
+        float force_dot = tVec3f::dot(bike.facing_direction, plane.normal);
+
+        if (bike.jumping_off_ramp && force_dot >= 0.f) {
+          // Same principle as the front wheel collision restriction above
+          continue;
+        }
+
+        tVec3f resolved_position = back.collision_point + plane.normal * back_wheel_ground_distance;
+
+        if (resolved_position.y > highest_back_y) {
+          ideal_back_wheel_position = resolved_position;
+          highest_back_y = resolved_position.y;
+          back_wheel_plane_normal = plane.normal;
         }
       }
     }
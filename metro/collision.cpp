@@ -119,4 +119,37 @@ CollisionTest Collision::TestRayHit(const tVec3f& ray_start, const tVec3f& ray,
   }
 
   return test;
+}
+
+void Collision::BuildCollisionPlaneIndex(CollisionPlaneIndex& index) {
+  // @allocation
+  std::vector<tBounds> plane_bounds;
+
+  plane_bounds.reserve(index.planes.size());
+
+  for (auto& plane : index.planes) {
+    tBounds bounds;
+
+    bounds.min.x = std::min({ plane.p1.x, plane.p2.x, plane.p3.x, plane.p4.x });
+    bounds.min.y = plane.min_y;
+    bounds.min.z = std::min({ plane.p1.z, plane.p2.z, plane.p3.z, plane.p4.z });
+
+    bounds.max.x = std::max({ plane.p1.x, plane.p2.x, plane.p3.x, plane.p4.x });
+    bounds.max.y = plane.max_y;
+    bounds.max.z = std::max({ plane.p1.z, plane.p2.z, plane.p3.z, plane.p4.z });
+
+    plane_bounds.push_back(bounds);
+  }
+
+  Tachyon_BuildBVH(index.bvh, plane_bounds);
+}
+
+/**
+ * Returns the indexes of all planes whose bounds overlap the given
+ * bounds. The results are only valid until the next query.
+ */
+const std::vector<uint32>& Collision::QueryCollisionPlanes(CollisionPlaneIndex& index, const tBounds& bounds) {
+  Tachyon_QueryBVHBounds(index.bvh, bounds, index.query_results);
+
+  return index.query_results;
 }
\ No newline at end of file
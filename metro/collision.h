@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "engine/tachyon_bvh.h"
 #include "engine/tachyon_types.h"
 
 namespace metro {
@@ -14,6 +17,17 @@ namespace metro {
     float min_y = 0.f;
   };
 
+  /**
+   * Every collision plane in the level, with a BVH over their
+   * bounds, so collision checks only test nearby planes.
+   * Rebuilt whenever static entities are updated or removed.
+   */
+  struct CollisionPlaneIndex {
+    std::vector<CollisionPlane> planes;
+    tBVH bvh;
+    std::vector<uint32> query_results;
+  };
+
   struct CollisionTest {
     tVec3f collision_point;
     bool has_collision = false;
@@ -36,5 +50,7 @@ namespace metro {
     CollisionPlane CreateFloorCollisionPlane(const Transform& transform);
     CollisionPlane CreateSlopeCollisionPlane(const Transform& transform);
     CollisionTest TestRayHit(const tVec3f& ray_start, const tVec3f& ray, const CollisionPlane& plane);
+    void BuildCollisionPlaneIndex(CollisionPlaneIndex& index);
+    const std::vector<uint32>& QueryCollisionPlanes(CollisionPlaneIndex& index, const tBounds& bounds);
   }
 }
\ No newline at end of file
@@ -54,6 +54,34 @@ namespace metro {
     std::vector<CollisionPlane> collision_planes;
   };
 
+  // Subdivisions of the walkway surface between connected segments
+  const static uint32 WALKWAY_CONNECTION_SLICES = 5;
+  const static uint32 WALKWAY_CONNECTION_VERTICES = (WALKWAY_CONNECTION_SLICES + 1) * 2;
+  const static uint32 WALKWAY_CONNECTION_ELEMENTS = WALKWAY_CONNECTION_SLICES * 6;
+  const static uint32 WALKWAY_CONNECTION_PLANES = WALKWAY_CONNECTION_SLICES * 2;
+
+  /**
+   * The walkway surface leading from one walkway segment to
+   * another. Each connection occupies a fixed-size slot in the
+   * walkway vertex stream, so it can be rebuilt in place.
+   */
+  struct WalkwayConnection {
+    int32 entity_id = -1;
+    int32 next_id = -1;
+    uint32 slot = 0;
+
+    CollisionPlane collision_planes[WALKWAY_CONNECTION_PLANES];
+  };
+
+  struct Walkways {
+    std::vector<WalkwayConnection> connections;
+    std::vector<uint32> free_slots;
+    uint32 total_slots = 0;
+
+    tSpatialGrid segment_grid;
+    std::vector<uint32> neighbor_indexes;
+  };
+
   struct InteractiveEntity : BaseEntity {
     // @todo
   };
@@ -67,6 +95,8 @@ namespace metro {
 
     // Interactives
     std::vector<InteractiveEntity> vending_machines;
+
+    Walkways walkways;
   };
 
   int32 CreateUniqueId();
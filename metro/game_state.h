@@ -136,6 +136,7 @@ namespace metro {
 
     std::vector<Bicycle> bicycles;
     Entities entities;
+    CollisionPlaneIndex collision_planes;
 
     std::string world_level_name = "test_world.lvl";
 
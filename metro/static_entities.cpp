@@ -1,7 +1,12 @@
+#include <unordered_map>
+#include <unordered_set>
+
 #include "metro/static_entities.h"
 
 using namespace metro;
 
+const static float WALKWAY_CONNECTION_DISTANCE = 15000.f;
+
 #define OnInit() static void Init(Tachyon* tachyon, State& state)
 #define OnUpdate() static void Update(Tachyon* tachyon, State& state, StaticEntity& entity, int32 index)
 #define OnRemove() static void Remove(Tachyon* tachyon, State& state, int32 index)
@@ -136,142 +141,295 @@ static inline std::tuple<tVec3f, tVec3f> GetSegmentEdge(const StaticEntity& enti
   };
 }
 
-static void RebuildWalkways(Tachyon* tachyon, State& state) {
+static void ClearWalkwayConnectionSlot(tVertexStream& stream, const uint32 slot) {
+  uint32 vertex_offset = slot * WALKWAY_CONNECTION_VERTICES;
+  uint32 element_offset = slot * WALKWAY_CONNECTION_ELEMENTS;
+
+  // Collapse the slot's triangles, so nothing is drawn
+  for (uint32 i = 0; i < WALKWAY_CONNECTION_ELEMENTS; i++) {
+    stream.face_elements[element_offset + i] = vertex_offset;
+  }
+
+  Tachyon_PatchVertexStream(stream, 0, 0, element_offset, WALKWAY_CONNECTION_ELEMENTS);
+}
+
+static uint32 AllocateWalkwayConnectionSlot(tVertexStream& stream, Walkways& walkways) {
+  if (walkways.free_slots.size() > 0) {
+    uint32 slot = walkways.free_slots.back();
+
+    walkways.free_slots.pop_back();
+
+    return slot;
+  }
+
+  uint32 slot = walkways.total_slots++;
+
+  // @allocation
+  stream.vertices.resize(walkways.total_slots * WALKWAY_CONNECTION_VERTICES);
+  stream.face_elements.resize(walkways.total_slots * WALKWAY_CONNECTION_ELEMENTS);
+
+  return slot;
+}
+
+/**
+ * Creates the walkway surface from one segment to the next,
+ * if the segments are close enough and facing one another.
+ * Returns true if the segments were connected.
+ */
+static bool MaybeConnectWalkwaySegments(Tachyon* tachyon, State& state, const StaticEntity& entity, const StaticEntity& next) {
+  auto& walkways = state.entities.walkways;
   auto& stream = vertex_stream(state.meshes.walkway_stream);
 
-  stream.vertices.clear();
-  stream.face_elements.clear();
-  stream.buffered = false;
+  float distance = tVec3f::distance(entity.position, next.position);
+  tVec3f entity_facing_direction = entity.rotation.getDirection();
+  tVec3f next_facing_direction = next.rotation.getDirection();
+  tVec3f path_direction = next.position - entity.position;
+  float next_dot = tVec3f::dot(path_direction, next_facing_direction);
+
+  if (distance >= WALKWAY_CONNECTION_DISTANCE || next_dot <= 0.f) {
+    return false;
+  }
+
+  float x_scale = (GetWiderHorizontalScale(entity) + GetWiderHorizontalScale(next)) / 2.f;
+  float z_scale = distance / 2.f;
+
+  Debug::ShowDebugVector(tachyon, entity.position, entity_facing_direction * 2000.f, tVec3f(1.f));
+  Debug::ShowDebugVector(tachyon, next.position, next_facing_direction * 2000.f, tVec3f(1.f));
+
+  float direction_dot = tVec3f::dot(
+    entity_facing_direction,
+    next.rotation.getLeftDirection()
+  );
+
+  tVec3f unit_path_direction = path_direction / distance;
+
+  // Determine the four corners of the plane between the segments
+  auto [A, B] = GetSegmentEdge(entity);
+  auto [C, D] = GetSegmentEdge(next);
+
+  float edge_AC_factor = tVec3f::distance(A, C) / distance;
+  float edge_BD_factor = tVec3f::distance(B, D) / distance;
+
+  const int total_slices = WALKWAY_CONNECTION_SLICES;
+
+  WalkwayConnection connection;
+  connection.entity_id = entity.id;
+  connection.next_id = next.id;
+  connection.slot = AllocateWalkwayConnectionSlot(stream, walkways);
+
+  uint32 vertex_offset = connection.slot * WALKWAY_CONNECTION_VERTICES;
+  uint32 element_offset = connection.slot * WALKWAY_CONNECTION_ELEMENTS;
+  uint32 vertex_index = vertex_offset;
+  uint32 element_index = element_offset;
+
+  // Create vertices to form subdivided slices of the plane
+  for_range(0, total_slices) {
+    float a = float(i) / (float) total_slices;
+
+    tVec3f p1 = tVec3f::lerp(A, C, a);
+    tVec3f p2 = tVec3f::lerp(B, D, a);
+
+    if (i > 0 && i < total_slices) {
+      float shift_factor = 0.25f * sinf(a * t_PI);
+
+      tVec3f p1_shift = (p2 - p1) * direction_dot * shift_factor * edge_AC_factor;
+      tVec3f p2_shift = (p2 - p1) * direction_dot * shift_factor * edge_BD_factor;
+
+      p1 += p1_shift;
+      p2 += p2_shift;
+    }
+
+    tVec3f normal = tVec3f::cross(
+      unit_path_direction,
+      (p2 - p1).unit()
+    );
+
+    stream.vertices[vertex_index++] = {
+      .position = p1,
+      .normal = normal
+    };
+
+    stream.vertices[vertex_index++] = {
+      .position = p2,
+      .normal = normal
+    };
+  }
+
+  // Create face elements + collision for the subdivided plane slices
+  for_range(1, total_slices) {
+    uint32 offset = vertex_offset + (i - 1) * 2;
+
+    // Triangle 1; 0 2 1
+    stream.face_elements[element_index++] = offset;
+    stream.face_elements[element_index++] = offset + 2;
+    stream.face_elements[element_index++] = offset + 1;
+
+    // Triangle 2; 1 2 3
+    stream.face_elements[element_index++] = offset + 1;
+    stream.face_elements[element_index++] = offset + 2;
+    stream.face_elements[element_index++] = offset + 3;
+
+    // Triangle 1 collision
+    {
+      auto& plane = connection.collision_planes[(i - 1) * 2];
+      plane.p1 = stream.vertices[offset].position;
+      plane.p2 = stream.vertices[offset + 2].position;
+      plane.p3 = stream.vertices[offset + 1].position;
+      plane.p4 = stream.vertices[offset].position;
+
+      Collision::PadCollisionPlane(plane, 300.f);
+      Collision::PrepareCollisionPlane(plane);
+    }
+
+    // Triangle 2 collision
+    {
+      auto& plane = connection.collision_planes[(i - 1) * 2 + 1];
+      plane.p1 = stream.vertices[offset + 1].position;
+      plane.p2 = stream.vertices[offset + 2].position;
+      plane.p3 = stream.vertices[offset + 3].position;
+      plane.p4 = stream.vertices[offset + 1].position;
+
+      Collision::PadCollisionPlane(plane, 300.f);
+      Collision::PrepareCollisionPlane(plane);
+    }
+  }
+
+  Tachyon_PatchVertexStream(stream, vertex_offset, WALKWAY_CONNECTION_VERTICES, element_offset, WALKWAY_CONNECTION_ELEMENTS);
+
+  walkways.connections.push_back(connection);
+
+  return true;
+}
+
+/**
+ * Rebuilds the walkway surfaces and collision planes leading to or
+ * from changed walkway segments, patching their slots in the walkway
+ * vertex stream. Surfaces between unchanged segments are left as-is.
+ */
+static void RebuildWalkways(Tachyon* tachyon, State& state, const std::unordered_set<int32>& changed_segment_ids) {
+  auto& walkways = state.entities.walkways;
+  auto& segments = state.entities.walkway_segments;
+  auto& stream = vertex_stream(state.meshes.walkway_stream);
 
   reset_instances(state.meshes.walkway_plane);
 
-  // Clear any collision planes present on the segment entities.
-  // We'll add new ones based on connections between them.
-  for (auto& entity : state.entities.walkway_segments) {
-    entity.collision_planes.clear();
+  // Segments whose collision planes need to be gathered again
+  std::unordered_set<int32> affected_segment_ids = changed_segment_ids;
+
+  // Remove connections to or from changed segments
+  for_reversed(walkways.connections) {
+    auto& connection = walkways.connections[i];
+
+    if (
+      changed_segment_ids.contains(connection.entity_id) ||
+      changed_segment_ids.contains(connection.next_id)
+    ) {
+      ClearWalkwayConnectionSlot(stream, connection.slot);
+
+      walkways.free_slots.push_back(connection.slot);
+      affected_segment_ids.insert(connection.entity_id);
+
+      if (i < (int32) walkways.connections.size() - 1) {
+        std::swap(walkways.connections[i], walkways.connections.back());
+      }
+
+      walkways.connections.pop_back();
+    }
   }
 
-  for (auto& entity : state.entities.walkway_segments) {
-    for (auto& next : state.entities.walkway_segments) {
+  // Index segment positions for neighbor queries
+  {
+    // @allocation
+    std::vector<tVec3f> positions;
+
+    positions.reserve(segments.size());
+
+    for (auto& entity : segments) {
+      positions.push_back(entity.position);
+    }
+
+    Tachyon_BuildSpatialGrid(walkways.segment_grid, positions, WALKWAY_CONNECTION_DISTANCE);
+  }
+
+  // Reconnect changed segments with their neighbors, in both directions
+  for (auto& entity : segments) {
+    if (!changed_segment_ids.contains(entity.id)) continue;
+
+    Tachyon_QuerySpatialGrid(walkways.segment_grid, entity.position, WALKWAY_CONNECTION_DISTANCE, walkways.neighbor_indexes);
+
+    for (auto index : walkways.neighbor_indexes) {
+      auto& next = segments[index];
+
       if (IsSameEntity(entity, next)) continue;
 
-      float distance = tVec3f::distance(entity.position, next.position);
-      tVec3f entity_facing_direction = entity.rotation.getDirection();
-      tVec3f next_facing_direction = next.rotation.getDirection();
-      tVec3f path_direction = next.position - entity.position;
-      float next_dot = tVec3f::dot(path_direction, next_facing_direction);
-
-      if (distance < 15000.f && next_dot > 0.f) {
-        float x_scale = (GetWiderHorizontalScale(entity) + GetWiderHorizontalScale(next)) / 2.f;
-        float z_scale = distance / 2.f;
-
-        Debug::ShowDebugVector(tachyon, entity.position, entity_facing_direction * 2000.f, tVec3f(1.f));
-        Debug::ShowDebugVector(tachyon, next.position, next_facing_direction * 2000.f, tVec3f(1.f));
-
-        float direction_dot = tVec3f::dot(
-          entity_facing_direction,
-          next.rotation.getLeftDirection()
-        );
-
-        tVec3f unit_path_direction = path_direction / distance;
-
-        // Determine the four corners of the plane between the segments
-        auto [A, B] = GetSegmentEdge(entity);
-        auto [C, D] = GetSegmentEdge(next);
-
-        float edge_AC_factor = tVec3f::distance(A, C) / distance;
-        float edge_BD_factor = tVec3f::distance(B, D) / distance;
-
-        const int total_slices = 5;
-        uint32 vertex_offset = (uint32) stream.vertices.size();
-
-        // Create vertices to form subdivided slices of the plane
-        for_range(0, total_slices) {
-          float a = float(i) / (float) total_slices;
-
-          tVec3f p1 = tVec3f::lerp(A, C, a);
-          tVec3f p2 = tVec3f::lerp(B, D, a);
-
-          if (i > 0 && i < total_slices) {
-            float shift_factor = 0.25f * sinf(a * t_PI);
-
-            tVec3f p1_shift = (p2 - p1) * direction_dot * shift_factor * edge_AC_factor;
-            tVec3f p2_shift = (p2 - p1) * direction_dot * shift_factor * edge_BD_factor;
-
-            p1 += p1_shift;
-            p2 += p2_shift;
-          }
-
-          tVec3f normal = tVec3f::cross(
-            unit_path_direction,
-            (p2 - p1).unit()
-          );
-
-          stream.vertices.push_back({
-            .position = p1,
-            .normal = normal
-          });
-
-          stream.vertices.push_back({
-            .position = p2,
-            .normal = normal
-          });
-        }
-
-        // Create face elements + collision for the subdivided plane slices
-        for_range(1, total_slices) {
-          uint32 offset = vertex_offset + (i - 1) * 2;
-
-          // Triangle 1; 0 2 1
-          stream.face_elements.push_back(offset);
-          stream.face_elements.push_back(offset + 2);
-          stream.face_elements.push_back(offset + 1);
-
-          // Triangle 2; 1 2 3
-          stream.face_elements.push_back(offset + 1);
-          stream.face_elements.push_back(offset + 2);
-          stream.face_elements.push_back(offset + 3);
-
-          // Triangle 1 collision
-          {
-            CollisionPlane plane;
-            plane.p1 = stream.vertices[offset].position;
-            plane.p2 = stream.vertices[offset + 2].position;
-            plane.p3 = stream.vertices[offset + 1].position;
-            plane.p4 = stream.vertices[offset].position;
-
-            Collision::PadCollisionPlane(plane, 300.f);
-            Collision::PrepareCollisionPlane(plane);
-
-            // @allocation
-            entity.collision_planes.push_back(plane);
-          }
-
-          // Triangle 2 collision
-          {
-            CollisionPlane plane;
-            plane.p1 = stream.vertices[offset + 1].position;
-            plane.p2 = stream.vertices[offset + 2].position;
-            plane.p3 = stream.vertices[offset + 3].position;
-            plane.p4 = stream.vertices[offset + 1].position;
-
-            Collision::PadCollisionPlane(plane, 300.f);
-            Collision::PrepareCollisionPlane(plane);
-
-            // @allocation
-            entity.collision_planes.push_back(plane);
-          }
-        }
+      MaybeConnectWalkwaySegments(tachyon, state, entity, next);
+
+      // Connections from other changed segments are
+      // made when handling those segments
+      if (
+        !changed_segment_ids.contains(next.id) &&
+        MaybeConnectWalkwaySegments(tachyon, state, next, entity)
+      ) {
+        affected_segment_ids.insert(next.id);
+      }
+    }
+  }
+
+  // Gather the collision planes for each affected segment
+  // from the connections leading away from it
+  std::unordered_map<int32, StaticEntity*> affected_segments;
+
+  for (auto& entity : segments) {
+    if (affected_segment_ids.contains(entity.id)) {
+      entity.collision_planes.clear();
+
+      affected_segments[entity.id] = &entity;
+    }
+  }
+
+  for (auto& connection : walkways.connections) {
+    auto entry = affected_segments.find(connection.entity_id);
+
+    if (entry != affected_segments.end()) {
+      auto& collision_planes = entry->second->collision_planes;
+
+      // @allocation
+      collision_planes.insert(
+        collision_planes.end(),
+        std::begin(connection.collision_planes),
+        std::end(connection.collision_planes)
+      );
+    }
+  }
+}
+
+// ---------------------------
+
+static void RebuildCollisionPlaneIndex(State& state) {
+  auto& index = state.collision_planes;
+
+  index.planes.clear();
+
+  for_static_entity_containers() {
+    for_entities() {
+      for (auto& plane : entity.collision_planes) {
+        index.planes.push_back(plane);
       }
     }
   }
+
+  Collision::BuildCollisionPlaneIndex(index);
 }
 
 // ---------------------------
 
+/**
+ * Returns true if any entities were updated or removed.
+ */
 template<typename Entity>
-static void HandleLifeCycle(Tachyon* tachyon, State& state, std::vector<StaticEntity>& entities) {
+static bool HandleLifeCycle(Tachyon* tachyon, State& state, std::vector<StaticEntity>& entities) {
   int32 index = 0;
+  bool did_change = false;
 
   for_reversed(entities) {
     auto& entity = entities[i];
@@ -288,6 +446,8 @@ static void HandleLifeCycle(Tachyon* tachyon, State& state, std::vector<StaticEn
       }
 
       entities.pop_back();
+
+      did_change = true;
     }
   }
 
@@ -302,31 +462,41 @@ static void HandleLifeCycle(Tachyon* tachyon, State& state, std::vector<StaticEn
 
     if (entity.needs_update) {
       Entity::Update(tachyon, state, entity, current_index);
+
+      did_change = true;
     }
   }
+
+  return did_change;
 }
 
 void StaticEntities::Update(Tachyon* tachyon, State& state) {
   profile("StaticEntities::Update()");
 
-  // Determine whether we need to rebuild walkways based on
+  // Determine which walkways need to be rebuilt based on
   // updated or deleted entities
-  bool should_rebuild_walkways = false;
+  static std::unordered_set<int32> changed_segment_ids;
+
+  changed_segment_ids.clear();
 
   for (auto& entity : state.entities.walkway_segments) {
     if (entity.needs_update || entity.needs_deletion) {
-      should_rebuild_walkways = true;
-
-      break;
+      changed_segment_ids.insert(entity.id);
     }
   }
 
-  HandleLifeCycle<Platforms>(tachyon, state, state.entities.platforms);
-  HandleLifeCycle<Ramps>(tachyon, state, state.entities.ramps);
-  HandleLifeCycle<RoadSegments>(tachyon, state, state.entities.road_segments);
-  HandleLifeCycle<WalkwaySegments>(tachyon, state, state.entities.walkway_segments);
+  bool did_change = false;
+
+  did_change |= HandleLifeCycle<Platforms>(tachyon, state, state.entities.platforms);
+  did_change |= HandleLifeCycle<Ramps>(tachyon, state, state.entities.ramps);
+  did_change |= HandleLifeCycle<RoadSegments>(tachyon, state, state.entities.road_segments);
+  did_change |= HandleLifeCycle<WalkwaySegments>(tachyon, state, state.entities.walkway_segments);
+
+  if (changed_segment_ids.size() > 0) {
+    RebuildWalkways(tachyon, state, changed_segment_ids);
+  }
 
-  if (should_rebuild_walkways) {
-    RebuildWalkways(tachyon, state);
+  if (did_change) {
+    RebuildCollisionPlaneIndex(state);
   }
 }
\ No newline at end of file